@@ -633,6 +633,388 @@ int OH_IPCParcel_WriteInterfaceToken(OHIPCParcel *parcel, const char *token);
 int OH_IPCParcel_ReadInterfaceToken(const OHIPCParcel *parcel, char **token, int32_t *len,
     OH_IPC_MemAllocator allocator);
 
+/**
+* @brief Defines a shared memory region that can be transferred through an **OHIPCParcel** object without copying its
+* content.
+*
+* @syscap SystemCapability.Communication.IPC.Core
+* @since 26.1.0
+*/
+struct OHIPCSharedRegion;
+
+/**
+* @brief Defines a shared memory region that can be transferred through an **OHIPCParcel** object without copying its
+* content.
+*
+* @syscap SystemCapability.Communication.IPC.Core
+* @since 26.1.0
+*/
+typedef struct OHIPCSharedRegion OHIPCSharedRegion;
+
+/**
+ * @brief Creates a shared memory region backed by anonymous shared memory. The region is mapped readable and writable
+ * in the calling process until it is written to an **OHIPCParcel** object, and holds one reference.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param name Pointer to the name of the region, which is used for debugging. It can be NULL.
+ * @param size Size of the region, in bytes. It must be greater than 0.
+ * @return Returns the pointer to the **OHIPCSharedRegion** object created if the operation is successful; returns NULL
+ *     otherwise.
+ * @since 26.1.0
+ */
+OHIPCSharedRegion* OH_IPCSharedRegion_Create(const char *name, uint64_t size);
+
+/**
+ * @brief Adds a reference to an **OHIPCSharedRegion** object, for example, to keep a region read from an
+ * **OHIPCParcel** object mapped after the parcel is destroyed.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region Pointer to the **OHIPCSharedRegion** object. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 26.1.0
+ */
+int OH_IPCSharedRegion_Retain(OHIPCSharedRegion *region);
+
+/**
+ * @brief Releases a reference to an **OHIPCSharedRegion** object. The region is unmapped and closed when the last
+ * reference is released.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region Pointer to the **OHIPCSharedRegion** object.
+ * @since 26.1.0
+ */
+void OH_IPCSharedRegion_Release(OHIPCSharedRegion *region);
+
+/**
+ * @brief Obtains the writable address of an **OHIPCSharedRegion** object. Only the process that created the region can
+ * write to it, and only until the region is written to an **OHIPCParcel** object, which seals it.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region Pointer to the **OHIPCSharedRegion** object. It cannot be NULL.
+ * @return Returns the writable address of the region; returns NULL if invalid parameters are found, the region was
+ *     read from an **OHIPCParcel** object, or the region has been sealed by {@link OH_IPCParcel_WriteSharedRegion}.
+ * @since 26.1.0
+ */
+uint8_t* OH_IPCSharedRegion_GetWritableData(OHIPCSharedRegion *region);
+
+/**
+ * @brief Obtains the readable address of an **OHIPCSharedRegion** object. A region read from an **OHIPCParcel** object
+ * is mapped read-only in the receiving process.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region Pointer to the **OHIPCSharedRegion** object. It cannot be NULL.
+ * @return Returns the readable address of the region; returns NULL if invalid parameters are found.
+ * @since 26.1.0
+ */
+const uint8_t* OH_IPCSharedRegion_GetData(const OHIPCSharedRegion *region);
+
+/**
+ * @brief Obtains the size of an **OHIPCSharedRegion** object.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region Pointer to the **OHIPCSharedRegion** object. It cannot be NULL.
+ * @return Returns the size of the region, in bytes; returns **0** if invalid parameters are found.
+ * @since 26.1.0
+ */
+uint64_t OH_IPCSharedRegion_GetSize(const OHIPCSharedRegion *region);
+
+/**
+ * @brief Writes an **OHIPCSharedRegion** object to an **OHIPCParcel** object. Only the handle of the region is written;
+ * its content is not copied. The parcel holds a reference to the region until {@link OH_IPCParcel_Destroy} is called.
+ * <br>Before the handle is written, the region is sealed so that the receiver cannot observe later modifications: the
+ * writable mapping of the creator is replaced by a read-only one, and the backing memory is sealed with
+ * **F_SEAL_WRITE** (memfd) or set to read-only protection (ashmem). Sealing cannot be undone, and
+ * {@link OH_IPCSharedRegion_GetWritableData} returns NULL afterwards. Writing a sealed region again is allowed.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param region Pointer to the **OHIPCSharedRegion** object to write. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the write operation or sealing fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WriteSharedRegion(OHIPCParcel *parcel, OHIPCSharedRegion *region);
+
+/**
+ * @brief Reads an **OHIPCSharedRegion** object from an **OHIPCParcel** object and maps it read-only. The region is
+ * owned by the parcel and is unmapped by {@link OH_IPCParcel_Destroy} unless {@link OH_IPCSharedRegion_Retain} is
+ * called.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param region Double pointer to the **OHIPCSharedRegion** object read. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the read operation or the mapping fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadSharedRegion(const OHIPCParcel *parcel, OHIPCSharedRegion **region);
+
+/**
+ * @brief Sets the size from which {@link OH_IPCParcel_WriteLargeBuffer} transfers data through a shared memory region
+ * instead of copying it into the parcel.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param threshold Size threshold, in bytes. The default value is **16384**.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_SetSharedRegionThreshold(OHIPCParcel *parcel, uint32_t threshold);
+
+/**
+ * @brief Writes data of the specified length to an **OHIPCParcel** object. Data smaller than the threshold set by
+ * {@link OH_IPCParcel_SetSharedRegionThreshold} is copied into the parcel as by {@link OH_IPCParcel_WriteBuffer};
+ * larger data is copied once into a new shared memory region that is written to the parcel, so it is not limited by the
+ * parcel size and is not copied again on the way to the receiver. Inline data is padded to start at an 8-byte aligned
+ * address of the parcel data.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param buffer Pointer to the data to write. It cannot be NULL.
+ * @param len Length of the data to write, in bytes.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the write operation fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WriteLargeBuffer(OHIPCParcel *parcel, const uint8_t *buffer, uint64_t len);
+
+/**
+ * @brief Reads data written by {@link OH_IPCParcel_WriteLargeBuffer} from an **OHIPCParcel** object without copying
+ * it. The returned address points either into the parcel or into a read-only shared memory region, and stays valid
+ * until {@link OH_IPCParcel_Destroy} is called.
+ * <br>The address is 8-byte aligned for data inside the parcel and page-aligned for data in a shared memory region.
+ * To access the data as a type with an alignment stricter than 8 bytes, copy it out with **memcpy** first.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param buffer Pointer to the address of the data read. It cannot be NULL.
+ * @param len Pointer to the length of the data read, in bytes. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the read operation fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadLargeBuffer(const OHIPCParcel *parcel, const uint8_t **buffer, uint64_t *len);
+
+/**
+ * @brief Obtains an **OHIPCParcel** object from the parcel pool of the calling thread. If the pool is empty, a new
+ * object is created. The object is empty and has at least **capacityHint** bytes of data space reserved, so writes up
+ * to that size do not reallocate. Return the object with {@link OH_IPCParcel_Recycle} to reuse it, or destroy it with
+ * {@link OH_IPCParcel_Destroy}.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param capacityHint Expected data size, in bytes. The value **0** means no reservation. The value cannot exceed the
+ *     maximum size of an **OHIPCParcel** object.
+ * @return Returns the pointer to the **OHIPCParcel** object if the operation is successful; returns NULL otherwise.
+ * @since 26.1.0
+ */
+OHIPCParcel* OH_IPCParcel_Acquire(uint32_t capacityHint);
+
+/**
+ * @brief Returns an **OHIPCParcel** object to the parcel pool of the calling thread. The object is reset as by
+ * {@link OH_IPCParcel_Reset} and keeps its data buffer. If the pool already holds 8 objects, the object is destroyed
+ * instead. The object cannot be used after this function is called.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object to recycle.
+ * @since 26.1.0
+ */
+void OH_IPCParcel_Recycle(OHIPCParcel *parcel);
+
+/**
+ * @brief Reserves data space in an **OHIPCParcel** object so that writes up to the specified size do not reallocate.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param capacity Data size to reserve, in bytes. The value cannot exceed the maximum size of an **OHIPCParcel**
+ *     object.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR} if the memory allocation fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_Reserve(OHIPCParcel *parcel, uint32_t capacity);
+
+/**
+ * @brief Empties an **OHIPCParcel** object for reuse. The read and write positions are rewound to **0** and the
+ * objects held by the parcel, such as file descriptors and remote objects, are released, but the data buffer is kept.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_Reset(OHIPCParcel *parcel);
+
+/**
+ * @brief Defines a caller-managed memory arena used by {@link OH_IPCParcel_ReadStringInArena}. The caller provides
+ * the memory and resets **used** to **0** to reuse it.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Start address of the arena memory. */
+    uint8_t *base;
+    /** Size of the arena memory, in bytes. */
+    uint32_t size;
+    /** Number of bytes already used. */
+    uint32_t used;
+} OH_IPC_Arena;
+
+/**
+ * @brief Reads a string from an **OHIPCParcel** object and copies it, including the string terminator, into a
+ * caller-supplied arena. Unlike {@link OH_IPCParcel_ReadString}, the string remains valid after the parcel is reset,
+ * recycled or destroyed, and no memory is allocated.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param arena Pointer to the arena. It cannot be NULL.
+ * @param str Pointer to the address of the string read. It cannot be NULL.
+ * @param len Pointer to the length of the string read, excluding the terminator. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the read operation fails.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR} if the arena does not have enough space. In this
+ *     case, the read position is not moved.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadStringInArena(const OHIPCParcel *parcel, OH_IPC_Arena *arena, const char **str, int32_t *len);
+
+/**
+ * @brief Enumerates the field types that can be described in a struct schema.
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** int8_t field. */
+    OH_IPC_FIELD_INT8 = 0,
+    /** int16_t field. */
+    OH_IPC_FIELD_INT16 = 1,
+    /** int32_t field. */
+    OH_IPC_FIELD_INT32 = 2,
+    /** int64_t field. */
+    OH_IPC_FIELD_INT64 = 3,
+    /** uint8_t field. */
+    OH_IPC_FIELD_UINT8 = 4,
+    /** uint16_t field. */
+    OH_IPC_FIELD_UINT16 = 5,
+    /** uint32_t field. */
+    OH_IPC_FIELD_UINT32 = 6,
+    /** uint64_t field. */
+    OH_IPC_FIELD_UINT64 = 7,
+    /** float field. */
+    OH_IPC_FIELD_FLOAT = 8,
+    /** double field. */
+    OH_IPC_FIELD_DOUBLE = 9,
+    /** const char * field pointing to a string terminated with '\0'. */
+    OH_IPC_FIELD_STRING = 10,
+} OH_IPC_FieldType;
+
+/**
+ * @brief Describes a field of a struct to marshal with {@link OH_IPCParcel_WriteStruct}. An array of descriptors is
+ * the schema of the struct, and the writer and reader must use the same schema.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Offset of the field in the struct, which is usually obtained by **offsetof**. */
+    uint32_t offset;
+    /** Type of the field. */
+    OH_IPC_FieldType type;
+    /**
+     * Number of elements. The value **1** indicates a scalar field, and a larger value indicates a fixed-length array
+     * embedded in the struct. The value must be **1** for {@link OH_IPC_FIELD_STRING}.
+     */
+    uint32_t count;
+} OH_IPC_FieldDesc;
+
+/**
+ * @brief Writes a struct to an **OHIPCParcel** object according to a schema. The schema is checked and the space
+ * required is reserved once, and runs of adjacent numeric fields are copied with a single memory copy, which is
+ * faster than writing the fields one by one.
+ * <br>The type and element count of each field are written before the field data, so that
+ * {@link OH_IPCParcel_ReadStruct} can detect a schema mismatch.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param fields Pointer to the field descriptor array. It cannot be NULL.
+ * @param fieldCount Number of field descriptors. The value must be greater than 0.
+ * @param object Pointer to the struct to write. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the write operation fails. In this case, the write
+ *     position is not moved.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WriteStruct(OHIPCParcel *parcel, const OH_IPC_FieldDesc *fields, uint32_t fieldCount,
+    const void *object);
+
+/**
+ * @brief Reads a struct written by {@link OH_IPCParcel_WriteStruct} from an **OHIPCParcel** object. String fields are
+ * copied into the specified arena.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param fields Pointer to the field descriptor array, which must be the same as the one used for writing. It cannot
+ *     be NULL.
+ * @param fieldCount Number of field descriptors. The value must be greater than 0.
+ * @param object Pointer to the struct to fill in. It cannot be NULL.
+ * @param arena Pointer to the arena that holds the strings read. It can be NULL only if the schema has no string field.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the read operation fails, or if the field count,
+ *     a field type, or a field element count in **fields** differs from the schema recorded by
+ *     {@link OH_IPCParcel_WriteStruct}.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR} if the arena does not have enough space.
+ *     The read position is not moved if the operation fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadStruct(const OHIPCParcel *parcel, const OH_IPC_FieldDesc *fields, uint32_t fieldCount,
+    void *object, OH_IPC_Arena *arena);
+
+/**
+ * @brief Writes an array of plain data elements, such as integers or structs without pointers, to an **OHIPCParcel**
+ * object. The element size and element count are written first, followed by the elements copied with a single memory
+ * copy. Padding is inserted before the elements so that they start at an 8-byte aligned address of the parcel data.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param data Pointer to the array. It can be NULL only if **count** is 0.
+ * @param elementSize Size of an element, in bytes. The value must be greater than 0.
+ * @param count Number of elements.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the write operation fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WritePodArray(OHIPCParcel *parcel, const void *data, uint32_t elementSize, uint32_t count);
+
+/**
+ * @brief Reads an array written by {@link OH_IPCParcel_WritePodArray} from an **OHIPCParcel** object without copying
+ * it. The address returned points to the parcel data and is valid until the parcel is reset or destroyed.
+ * <br>The address is 8-byte aligned, so it can be accessed directly as an array of any element type whose alignment
+ * is at most 8 bytes. For an element type with a stricter alignment, copy the data out with **memcpy** before use.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the **OHIPCParcel** object. It cannot be NULL.
+ * @param elementSize Size of an element, in bytes, which must be the same as the one used for writing.
+ * @param data Pointer to the address of the array read. It cannot be NULL.
+ * @param count Pointer to the number of elements read. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the read operation fails, or if **elementSize**
+ *     differs from the element size recorded by {@link OH_IPCParcel_WritePodArray}.
+ *     The read position is not moved if the operation fails.
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadPodArray(const OHIPCParcel *parcel, uint32_t elementSize, const void **data, uint32_t *count);
+
 #ifdef __cplusplus
 }
 #endif
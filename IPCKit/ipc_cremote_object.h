@@ -173,6 +173,112 @@ typedef struct {
 int OH_IPCRemoteProxy_SendRequest(const OHIPCRemoteProxy *proxy, uint32_t code, const OHIPCParcel *data,
     OHIPCParcel *reply, const OH_IPC_MessageOption *option);
 
+/**
+ * @brief Defines a request in a batch sent by {@link OH_IPCRemoteProxy_SendBatchRequest}.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Customized IPC command word, in the range [0x01, 0x00ffffff]. */
+    uint32_t code;
+    /** Pointer to the requested data object. It cannot be NULL. */
+    const OHIPCParcel *data;
+    /** Pointer to the response data object. It can be NULL for an asynchronous batch. */
+    OHIPCParcel *reply;
+    /**
+     * Result of the request. For a synchronous batch, it is the value returned by the stub, which is filled in when
+     * the batch completes. For an asynchronous batch, the stub's result is not returned, and it is set to
+     * {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} when the batch is sent.
+     */
+    int result;
+} OH_IPC_BatchRequest;
+
+/**
+ * @brief Sends multiple IPC messages to the same remote object in one transaction. The stub processes the requests in
+ * array order by calling its {@link OH_OnRemoteRequestCallback} once per request. For a synchronous batch, the result
+ * and reply of each request are filled in before this function returns; for an asynchronous batch, this function
+ * returns once the batch is sent, and only the **result** members are filled in as described in
+ * {@link OH_IPC_BatchRequest}. This amortizes the context switches of chatty interfaces over
+ * the whole batch.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy Pointer to the **OHIPCRemoteProxy** object. It cannot be NULL.
+ * @param requests Pointer to the request array. It cannot be NULL.
+ * @param count Number of requests in the array. The value ranges from 1 to 256.
+ * @param option Pointer to the message option. It can be NULL, which indicates a synchronous batch. In an asynchronous
+ * batch, the replies are not filled in.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the batch is sent successfully. The result of each
+ * request is returned in its **result** member.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT} if the remote **OHIPCRemoteStub** object dies.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CODE_OUT_OF_RANGE} if a code is out of range.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR} in other cases.
+ * @since 26.1.0
+ */
+int OH_IPCRemoteProxy_SendBatchRequest(const OHIPCRemoteProxy *proxy, OH_IPC_BatchRequest *requests,
+    uint32_t count, const OH_IPC_MessageOption *option);
+
+/**
+ * @brief Called when the reply to a request sent by {@link OH_IPCRemoteProxy_SendRequestAsync} is received.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param result Result of the request. The value is the same as the return value of
+ * {@link OH_IPCRemoteProxy_SendRequest}.
+ * @param reply Pointer to the response data object. It is NULL if the request fails, and it cannot be released or
+ * used after the callback returns.
+ * @param userData Pointer to the private user data. It can be NULL.
+ * @since 26.1.0
+ */
+typedef void (*OH_OnRemoteReplyCallback)(int result, const OHIPCParcel *reply, void *userData);
+
+/**
+ * @brief Sends an IPC message without blocking and delivers the reply through a callback. Requests sent to the same
+ * proxy in quick succession are pipelined: they are coalesced into as few transactions as possible, processed by the
+ * stub in sending order, and their callbacks are invoked in the same order on an IPC thread.
+ * <br>A queued request is sent when 16 requests are queued for the proxy or 1 ms after the oldest queued request was
+ * queued, whichever comes first, or earlier when {@link OH_IPCRemoteProxy_FlushAsyncRequests} is called.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy Pointer to the **OHIPCRemoteProxy** object. It cannot be NULL.
+ * @param code Customized IPC command word, in the range [0x01, 0x00ffffff].
+ * @param data Pointer to the requested data object. It cannot be NULL. It can be destroyed or reused once this
+ * function returns.
+ * @param callback Callback invoked with the reply. It cannot be NULL.
+ * @param userData Pointer to the private user data passed to the callback. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the request is queued successfully.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT} if the remote **OHIPCRemoteStub** object is dead.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CODE_OUT_OF_RANGE} if the code is out of range.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR} in other cases.
+ * @since 26.1.0
+ */
+int OH_IPCRemoteProxy_SendRequestAsync(const OHIPCRemoteProxy *proxy, uint32_t code, const OHIPCParcel *data,
+    OH_OnRemoteReplyCallback callback, void *userData);
+
+/**
+ * @brief Sends the requests queued by {@link OH_IPCRemoteProxy_SendRequestAsync} immediately and waits until all of
+ * their callbacks have been invoked or the timeout expires. This function cannot be called from an
+ * {@link OH_OnRemoteReplyCallback} or an {@link OH_OnRemoteRequestCallback}, where waiting could deadlock the IPC
+ * thread; such a call returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} without sending anything.
+ * A timeout is not an error: the requests still pending are reported through **pendingCount** and their callbacks are
+ * invoked later as usual.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy Pointer to the **OHIPCRemoteProxy** object. It cannot be NULL.
+ * @param timeoutMs Maximum waiting time, in milliseconds. The value **0** means to send the queued requests without
+ * waiting.
+ * @param pendingCount Pointer to the number of requests whose callbacks have not been invoked when this function
+ * returns. The value **0** means that all callbacks have been invoked. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the queued requests are sent, whether or not all
+ * callbacks have been invoked before the timeout.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found or the function is called
+ * from a reply or request callback.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT} if the remote **OHIPCRemoteStub** object is dead.
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR} if the requests fail to be sent.
+ * @since 26.1.0
+ */
+int OH_IPCRemoteProxy_FlushAsyncRequests(const OHIPCRemoteProxy *proxy, uint32_t timeoutMs, uint32_t *pendingCount);
+
 /**
  * @brief Obtains the interface descriptor from the stub.
  *
@@ -172,6 +172,139 @@ int OH_IPCSkeleton_SetCallingIdentity(const char *identity);
  */
 int OH_IPCSkeleton_IsHandlingTransaction(void);
 
+/**
+ * @brief Defines the number of latency histogram buckets in {@link OH_IPC_CallStats}.
+ *
+ * @since 26.1.0
+ */
+#define OH_IPC_CALL_LATENCY_BUCKET_NUM 20
+
+/**
+ * @brief Enumerates the sides on which IPC calls are recorded.
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** Requests sent through an **OHIPCRemoteProxy** object. */
+    OH_IPC_CALL_SIDE_PROXY = 0,
+    /** Requests handled by an **OHIPCRemoteStub** object. */
+    OH_IPC_CALL_SIDE_STUB = 1,
+} OH_IPC_CallSide;
+
+/**
+ * @brief Defines the statistics of the IPC calls with one interface descriptor and request code.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Interface descriptor, which is valid only during the {@link OH_IPC_CallStatsCallback} call. */
+    const char *descriptor;
+    /** Request code. */
+    uint32_t code;
+    /** Side on which the calls are recorded. */
+    OH_IPC_CallSide side;
+    /** Number of calls. */
+    uint64_t callCount;
+    /** Number of calls that did not return {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}. */
+    uint64_t failCount;
+    /** Total size of the request data, in bytes. */
+    uint64_t bytesOut;
+    /** Total size of the reply data, in bytes. */
+    uint64_t bytesIn;
+    /** Total latency, in microseconds. */
+    uint64_t totalLatencyUs;
+    /** Maximum latency, in microseconds. */
+    uint64_t maxLatencyUs;
+    /**
+     * Latency histogram. Bucket 0 counts calls shorter than 2 us, bucket i counts calls in [2^i, 2^(i+1)) us, and the
+     * last bucket also counts all longer calls.
+     */
+    uint64_t latencyHistogram[OH_IPC_CALL_LATENCY_BUCKET_NUM];
+} OH_IPC_CallStats;
+
+/**
+ * @brief Called once for each entry by {@link OH_IPCSkeleton_ForEachCallStats}.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param stats Pointer to the statistics entry, which is valid only during the callback.
+ * @param userData Pointer to the private user data. It can be NULL.
+ * @since 26.1.0
+ */
+typedef void (*OH_IPC_CallStatsCallback)(const OH_IPC_CallStats *stats, void *userData);
+
+/**
+ * @brief Enables or disables the IPC call statistics of this process. When enabled, every request sent or handled is
+ * recorded per interface descriptor and request code, using per-thread counters so that no lock is taken on the call
+ * path. It is disabled by default.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param enable Whether to enable the statistics. The value **1** means to enable it, and **0** means to disable it.
+ * @param traceEnable Whether to also emit each call as a HiTrace asynchronous slice named
+ *     "IPC:{descriptor}#{code}", and each death notification as a HiTrace event. The value **1** means to emit them,
+ *     and **0** means the opposite. It is ignored when **enable** is 0.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if the parameters are incorrect.
+ * @since 26.1.0
+ */
+int OH_IPCSkeleton_EnableCallStats(int enable, int traceEnable);
+
+/**
+ * @brief Traverses the IPC call statistics of this process. The per-thread counters are merged into a consistent
+ * snapshot before the callback is invoked, and the snapshot is not changed by calls made during the traversal.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param callback Callback invoked for each entry. It cannot be NULL.
+ * @param userData Pointer to the private user data passed to the callback. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if the parameters are incorrect.
+ * @since 26.1.0
+ */
+int OH_IPCSkeleton_ForEachCallStats(OH_IPC_CallStatsCallback callback, void *userData);
+
+/**
+ * @brief Defines the death notification statistics of one interface descriptor. Death notifications are not tied to a
+ * request code or side, so they are reported once per descriptor instead of in {@link OH_IPC_CallStats}.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Interface descriptor, which is valid only during the {@link OH_IPC_DeathStatsCallback} call. */
+    const char *descriptor;
+    /** Number of death notifications received for remote objects with this descriptor. */
+    uint64_t deathCount;
+} OH_IPC_DeathStats;
+
+/**
+ * @brief Called once for each descriptor by {@link OH_IPCSkeleton_ForEachDeathStats}.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param stats Pointer to the statistics entry, which is valid only during the callback.
+ * @param userData Pointer to the private user data. It can be NULL.
+ * @since 26.1.0
+ */
+typedef void (*OH_IPC_DeathStatsCallback)(const OH_IPC_DeathStats *stats, void *userData);
+
+/**
+ * @brief Traverses the death notification statistics of this process, which are recorded while the call statistics
+ * are enabled by {@link OH_IPCSkeleton_EnableCallStats}. Descriptors without any death notification are skipped.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param callback Callback invoked for each descriptor. It cannot be NULL.
+ * @param userData Pointer to the private user data passed to the callback. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful.
+ *     Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if the parameters are incorrect.
+ * @since 26.1.0
+ */
+int OH_IPCSkeleton_ForEachDeathStats(OH_IPC_DeathStatsCallback callback, void *userData);
+
+/**
+ * @brief Clears the IPC call statistics and death notification statistics of this process.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @since 26.1.0
+ */
+void OH_IPCSkeleton_ResetCallStats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -198,6 +198,90 @@ size_t OH_PurgeableMemory_ContentSize(OH_PurgeableMemory *purgObj);
 bool OH_PurgeableMemory_AppendModify(OH_PurgeableMemory *purgObj,
     OH_PurgeableMemory_ModifyFunc func, void *funcPara);
 
+/**
+ * @brief Defines a purgeable memory pool struct.
+ * <br>A pool packs many small purgeable memory objects into shared mappings, so that each object
+ * does not cost a separate mapping.
+ *
+ * @since 26.1.0
+ */
+typedef struct PurgMemPool OH_PurgeableMemoryPool;
+
+/**
+ * @brief Defines the statistics of a purgeable memory pool.
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_PurgeableMemoryPool_Stats {
+    /** Number of objects allocated from the pool and not yet destroyed. */
+    size_t objectCount;
+    /** Total content size of the objects whose content is present. */
+    size_t residentBytes;
+    /** Total content size of the objects whose content has been purged and not yet rebuilt. */
+    size_t purgedBytes;
+    /** Total size of the shared mappings held by the pool, including free space. */
+    size_t mappedBytes;
+    /** Number of times the content of an object was rebuilt since the pool was created. */
+    size_t rebuildCount;
+} OH_PurgeableMemoryPool_Stats;
+
+/**
+ * @brief create a purgeable memory pool.
+ *
+ *
+ * @param chunkSize Size of each shared mapping of the pool. It is rounded up to a multiple of the page size.
+ *     <br>Pass 0 to use the default size.
+ * @return a purgeable memory pool, or NULL if the pool fails to be created.
+ *
+ * @since 26.1.0
+ */
+OH_PurgeableMemoryPool *OH_PurgeableMemoryPool_Create(size_t chunkSize);
+
+/**
+ * @brief destroy a purgeable memory pool.
+ *
+ *
+ * @param pool Pointer to the purgeable memory pool to be destroyed.
+ * @return true is success, while false is fail. return true if pool is NULL.
+ *     <br>Return false if objects allocated from the pool are not destroyed.
+ *
+ * @since 26.1.0
+ */
+bool OH_PurgeableMemoryPool_Destroy(OH_PurgeableMemoryPool *pool);
+
+/**
+ * @brief allocate a PurgMem obj from a purgeable memory pool.
+ *
+ * The object is packed together with other objects of the pool, and the purge state is tracked
+ * for each object rather than for each page. The returned object is used with the same APIs as
+ * an object returned by OH_PurgeableMemory_Create(), and is destroyed with OH_PurgeableMemory_Destroy().
+ * <br>The content is not built at allocation. It is built with func on the first
+ * OH_PurgeableMemory_BeginRead() or OH_PurgeableMemory_BeginWrite() call, and rebuilt in the same
+ * way after it is purged.
+ *
+ * @param pool Pointer to the purgeable memory pool.
+ * @param size Data size of the content of a purgeable memory object.
+ * @param func Function used to build data when the content of a purgeable memory object is absent.
+ * @param funcPara Pointer to the parameter used by func.
+ * @return a PurgMem obj, or NULL if pool or func is NULL, size is 0, or the allocation fails.
+ *
+ * @since 26.1.0
+ */
+OH_PurgeableMemory *OH_PurgeableMemoryPool_Alloc(OH_PurgeableMemoryPool *pool,
+    size_t size, OH_PurgeableMemory_ModifyFunc func, void *funcPara);
+
+/**
+ * @brief get the statistics of a purgeable memory pool.
+ *
+ *
+ * @param pool Pointer to the purgeable memory pool.
+ * @param stats Pointer to the statistics to be filled in.
+ * @return true is success, while false is fail. return false if pool or stats is NULL.
+ *
+ * @since 26.1.0
+ */
+bool OH_PurgeableMemoryPool_GetStats(OH_PurgeableMemoryPool *pool, OH_PurgeableMemoryPool_Stats *stats);
+
 #ifdef __cplusplus
 }
 #endif /* End of #ifdef __cplusplus */
@@ -41,6 +41,9 @@
 #ifndef GLOBAL_RAW_DIR_H
 #define GLOBAL_RAW_DIR_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -105,6 +108,118 @@ int OH_ResourceManager_GetRawFileCount(RawDir *rawDir);
  */
 void OH_ResourceManager_CloseRawDir(RawDir *rawDir);
 
+/**
+ * @brief `RawFileIndex` represents a read-only snapshot of all paths under the `rawfile` directory, indexed by a hash
+ * table for constant-time lookup. It is obtained through {@link OH_ResourceManager_CreateRawFileIndex}, and must be
+ * released through {@link OH_ResourceManager_ReleaseRawFileIndex} after use.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct RawFileIndex RawFileIndex;
+
+/**
+ * @brief Enumerates the types of paths in a `RawFileIndex`.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef enum {
+    /** The path does not exist. */
+    RAWFILE_ENTRY_NONE = 0,
+    /** The path is a file. */
+    RAWFILE_ENTRY_FILE = 1,
+    /** The path is a directory. */
+    RAWFILE_ENTRY_DIR = 2,
+} RawFileEntryType;
+
+/**
+ * @brief Called for each path matched by {@link OH_ResourceManager_ListRawFileIndexByPrefix} or
+ * {@link OH_ResourceManager_ListRawFileIndexByGlob}.
+ *
+ * @param path Input parameter. Path relative to the `rawfile` root directory, which points into the snapshot and is
+ *     valid until the index is released. No memory is allocated for it.
+ * @param type Input parameter. Type of the path.
+ * @param userData Input parameter. Pointer to the user data passed to the listing function.
+ * @return **true** to continue listing; **false** to stop.
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef bool (*OH_ResourceManager_OnRawFileIndexEntry)(const char *path, RawFileEntryType type, void *userData);
+
+/**
+ * @brief Looks up a path in a `RawFileIndex` in constant time, without going through the resource manager. It can
+ * replace {@link OH_ResourceManager_IsRawDir} and the check for whether a file exists before opening it.
+ *
+ * @param index Input parameter. Pointer to a `RawFileIndex` object, which is obtained through
+ *     {@link OH_ResourceManager_CreateRawFileIndex}.
+ * @param path Input parameter. Path relative to the `rawfile` root directory, for example, `images/icons/1.png`.
+ * @param size Output parameter. Pointer to the length of the file, in bytes. It is set to `0` for a directory. The
+ *     value can be `NULL`.
+ * @return Type of the path. {@link RAWFILE_ENTRY_NONE} is returned if the path does not exist or `index` or `path` is
+ *     `NULL`.
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileEntryType OH_ResourceManager_LookupRawFileIndex(const RawFileIndex *index, const char *path, int64_t *size);
+
+/**
+ * @brief Lists the paths that start with the specified prefix in a `RawFileIndex`, in lexicographic order. Paths are
+ * stored sorted in the snapshot, so the listing is a range scan.
+ *
+ * @param index Input parameter. Pointer to a `RawFileIndex` object, which is obtained through
+ *     {@link OH_ResourceManager_CreateRawFileIndex}.
+ * @param prefix Input parameter. Path prefix, for example, `images/`. If the value is an empty string, all paths are
+ *     listed.
+ * @param callback Input parameter. Callback invoked for each matched path.
+ * @param userData Input parameter. Pointer to the user data passed to the callback. The value can be `NULL`.
+ * @return Number of paths passed to the callback. `-1` is returned if `index`, `prefix` or `callback` is `NULL`.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_ResourceManager_ListRawFileIndexByPrefix(const RawFileIndex *index, const char *prefix,
+    OH_ResourceManager_OnRawFileIndexEntry callback, void *userData);
+
+/**
+ * @brief Lists the paths that match the specified glob pattern in a `RawFileIndex`, in lexicographic order.
+ * <br>`*` matches any characters except `/`, `?` matches one character except `/`, and `**` matches any characters,
+ * including `/`. The literal part before the first wildcard is used as a prefix to limit the scan.
+ *
+ * @param index Input parameter. Pointer to a `RawFileIndex` object, which is obtained through
+ *     {@link OH_ResourceManager_CreateRawFileIndex}.
+ * @param pattern Input parameter. Glob pattern, for example, `textures/ui_*.png`.
+ * @param callback Input parameter. Callback invoked for each matched path.
+ * @param userData Input parameter. Pointer to the user data passed to the callback. The value can be `NULL`.
+ * @return Number of paths passed to the callback. `-1` is returned if `index`, `pattern` or `callback` is `NULL`.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_ResourceManager_ListRawFileIndexByGlob(const RawFileIndex *index, const char *pattern,
+    OH_ResourceManager_OnRawFileIndexEntry callback, void *userData);
+
+/**
+ * @brief Obtains the total number of files and directories in a `RawFileIndex`, counted recursively.
+ *
+ * @param index Input parameter. Pointer to a `RawFileIndex` object, which is obtained through
+ *     {@link OH_ResourceManager_CreateRawFileIndex}.
+ * @return Number of paths. `0` is returned if `index` is `NULL`.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_ResourceManager_GetRawFileIndexCount(const RawFileIndex *index);
+
+/**
+ * @brief Releases a `RawFileIndex` object. The snapshot is shared by all indexes of the same HAP in the process and is
+ * freed when the last of them is released.
+ *
+ * @param index Input parameter. Pointer to a `RawFileIndex` object, which is obtained through
+ *     {@link OH_ResourceManager_CreateRawFileIndex}. After the release, the pointer and all paths obtained from it
+ *     become invalid.
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_ResourceManager_ReleaseRawFileIndex(RawFileIndex *index);
+
 #ifdef __cplusplus
 };
 #endif
@@ -394,6 +394,103 @@ bool OH_ResourceManager_GetRawFileDescriptor64(const RawFile64 *rawFile, RawFile
  */
 bool OH_ResourceManager_ReleaseRawFileDescriptor64(const RawFileDescriptor64 *descriptor);
 
+/**
+ * @brief `RawFileMapping` represents a read-only memory-mapped view of a rawfile. It is obtained through
+ * {@link OH_ResourceManager_MapRawFile}, and must be released through {@link OH_ResourceManager_UnmapRawFile} after
+ * use.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct RawFileMapping RawFileMapping;
+
+/**
+ * @brief Enumerates the access pattern hints of a rawfile mapping, which are passed to the kernel through **madvise**.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef enum {
+    /** No special hint. */
+    RAWFILE_MAP_ADVICE_NORMAL = 0,
+    /** The mapping is read in sequential order, so the kernel reads ahead aggressively. */
+    RAWFILE_MAP_ADVICE_SEQUENTIAL = 1,
+    /** The mapping is read in random order, so the kernel does not read ahead. */
+    RAWFILE_MAP_ADVICE_RANDOM = 2,
+    /** The mapping will be read soon, so the kernel starts loading it in the background. */
+    RAWFILE_MAP_ADVICE_WILLNEED = 3,
+} RawFileMapAdvice;
+
+/**
+ * @brief Maps a rawfile into memory as a read-only view without copying its content. The view is created directly on
+ * the HAP file, so the pages are loaded on demand and shared with other mappings of the same rawfile in the system.
+ * <br>Mappings of the same rawfile in a process share one underlying view, which is reference counted and unmapped
+ * when its last mapping is released. The mapping remains valid after `rawFile` is closed.
+ *
+ * @param rawFile Input parameter. Pointer to a `RawFile64` object, which is obtained through
+ *     {@link OH_ResourceManager_OpenRawFile64}.
+ * @param advice Input parameter. Access pattern hint of the whole mapping.
+ * @return Pointer to the `RawFileMapping` object. If the operation fails, `NULL` is returned. The possible cause is
+ *     that `rawFile` is `NULL`, the rawfile is compressed in the HAP, or the memory mapping fails.
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileMapping *OH_ResourceManager_MapRawFile(const RawFile64 *rawFile, RawFileMapAdvice advice);
+
+/**
+ * @brief Obtains the start address of the rawfile content in a mapping. The underlying view is page-aligned within the
+ * HAP, and the address returned points to the first byte of the rawfile in the view.
+ *
+ * @param mapping Input parameter. Pointer to a `RawFileMapping` object, which is obtained through
+ *     {@link OH_ResourceManager_MapRawFile}.
+ * @return Start address of the rawfile content, which is read-only and valid until the mapping is released. If
+ *     `mapping` is `NULL`, `NULL` is returned.
+ * @since 26.1.0
+ * @version 1.0
+ */
+const void *OH_ResourceManager_GetRawFileMappingData(const RawFileMapping *mapping);
+
+/**
+ * @brief Obtains the length (in bytes) of the rawfile content in a mapping.
+ *
+ * @param mapping Input parameter. Pointer to a `RawFileMapping` object, which is obtained through
+ *     {@link OH_ResourceManager_MapRawFile}.
+ * @return Length of the rawfile content. If `mapping` is `NULL`, `0` is returned.
+ * @since 26.1.0
+ * @version 1.0
+ */
+int64_t OH_ResourceManager_GetRawFileMappingSize(const RawFileMapping *mapping);
+
+/**
+ * @brief Gives an access pattern hint for a range of a mapping, for example, to preload the part of a model that is
+ * used first with {@link RAWFILE_MAP_ADVICE_WILLNEED}. The range is expanded to page boundaries.
+ *
+ * @param mapping Input parameter. Pointer to a `RawFileMapping` object, which is obtained through
+ *     {@link OH_ResourceManager_MapRawFile}.
+ * @param offset Input parameter. Start of the range relative to the rawfile content, in bytes.
+ * @param length Input parameter. Length of the range, in bytes. The value `0` indicates the range up to the end of the
+ *     rawfile.
+ * @param advice Input parameter. Access pattern hint of the range.
+ * @return Result. If the operation is successful, `true` is returned. If the operation fails, `false` is returned.
+ *     The possible cause is that `mapping` is `NULL` or the range is out of the rawfile.
+ * @since 26.1.0
+ * @version 1.0
+ */
+bool OH_ResourceManager_AdviseRawFileMapping(const RawFileMapping *mapping, int64_t offset, int64_t length,
+    RawFileMapAdvice advice);
+
+/**
+ * @brief Releases a rawfile mapping. The underlying view is unmapped when the last mapping of the rawfile in the
+ * process is released.
+ *
+ * @param mapping Input parameter. Pointer to a `RawFileMapping` object, which is obtained through
+ *     {@link OH_ResourceManager_MapRawFile}. After the release, the pointer and the address obtained through
+ *     {@link OH_ResourceManager_GetRawFileMappingData} become invalid.
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_ResourceManager_UnmapRawFile(RawFileMapping *mapping);
+
 #ifdef __cplusplus
 };
 #endif
@@ -143,6 +143,139 @@ RawFile64 *OH_ResourceManager_OpenRawFile64(const NativeResourceManager *mgr, co
  */
 bool OH_ResourceManager_IsRawDir(const NativeResourceManager *mgr, const char *path);
 
+/**
+ * @brief Describes a read in a batch submitted through {@link OH_ResourceManager_ReadRawFilesAsync}.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /**
+     * Path of the file to be read. Path relative to the `rawfile` root directory, for example, `images/icons/1.png`.
+     */
+    const char *fileName;
+
+    /**
+     * Buffer for receiving the read data, which can hold at least `length` bytes. The memory is allocated by you and
+     * must not be freed before the read completes.
+     */
+    void *buf;
+
+    /**
+     * Offset in the rawfile from which data is read, in bytes.
+     */
+    int64_t offset;
+
+    /**
+     * Expected length of data to be read, in bytes. The value `-1` indicates up to the end of the file.
+     */
+    int64_t length;
+
+    /**
+     * Output. Length of the data read, in bytes, which is filled in when the read completes.
+     */
+    int64_t bytesRead;
+
+    /**
+     * Output. Read result, which is filled in when the read completes. `0` indicates success, and `-1` indicates
+     * failure. The possible cause is that the file does not exist or the offset is out of the file range.
+     */
+    int result;
+} RawFileReadRequest;
+
+/**
+ * @brief `RawFileReadBatch` represents a batch of asynchronous rawfile reads. It is obtained through
+ * {@link OH_ResourceManager_ReadRawFilesAsync}, and must be released through
+ * {@link OH_ResourceManager_ReleaseRawFileReadBatch} after use.
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct RawFileReadBatch RawFileReadBatch;
+
+/**
+ * @brief Called when a read in a batch completes.
+ *
+ * @param request Input parameter. Pointer to the completed read, whose `bytesRead` and `result` have been filled in.
+ * @param userData Input parameter. Pointer to the user data passed to {@link OH_ResourceManager_ReadRawFilesAsync}.
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef void (*OH_ResourceManager_OnRawFileRead)(RawFileReadRequest *request, void *userData);
+
+/**
+ * @brief Submits a batch of rawfile reads and returns without waiting for them. The reads are sorted by their position
+ * in the HAP, adjacent reads are merged, and the reads are issued in parallel on background threads, which is much
+ * faster than opening and reading the files one by one at startup.
+ *
+ * @param mgr Input parameter. Pointer to the `NativeResourceManager` object.
+ * @param requests Input parameter. Pointer to the read array, which must remain valid until the batch is released.
+ * @param count Input parameter. Number of reads in the array.
+ * @param callback Input parameter. Callback invoked on a background thread when each read completes. The callbacks may
+ *     be invoked in any order. The value can be `NULL`.
+ * @param userData Input parameter. Pointer to the user data passed to the callback. The value can be `NULL`.
+ * @return Pointer to the `RawFileReadBatch` object. If the call fails or `mgr` or `requests` is null, `NULL` is
+ *     returned. After use, call {@link OH_ResourceManager_ReleaseRawFileReadBatch} to release it.
+ * @see {@link OH_ResourceManager_WaitRawFileReadBatch}
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileReadBatch *OH_ResourceManager_ReadRawFilesAsync(const NativeResourceManager *mgr,
+    RawFileReadRequest *requests, uint32_t count, OH_ResourceManager_OnRawFileRead callback, void *userData);
+
+/**
+ * @brief Waits until all reads in a batch complete.
+ *
+ * @param batch Input parameter. Pointer to the `RawFileReadBatch` object, which is obtained through
+ *     {@link OH_ResourceManager_ReadRawFilesAsync}.
+ * @param timeoutMs Input parameter. Maximum waiting time, in milliseconds. The value `-1` indicates waiting
+ *     indefinitely.
+ * @return **true** if all reads have completed; **false** if the waiting times out or `batch` is null.
+ * @since 26.1.0
+ * @version 1.0
+ */
+bool OH_ResourceManager_WaitRawFileReadBatch(RawFileReadBatch *batch, int32_t timeoutMs);
+
+/**
+ * @brief Releases a batch of rawfile reads. The reads that have not started are canceled and their callbacks are not
+ * invoked, and this function returns after the running reads complete.
+ *
+ * @param batch Input parameter. Pointer to the `RawFileReadBatch` object, which is obtained through
+ *     {@link OH_ResourceManager_ReadRawFilesAsync}. After the release, the pointer becomes invalid.
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_ResourceManager_ReleaseRawFileReadBatch(RawFileReadBatch *batch);
+
+/**
+ * @brief Asynchronously loads rawfiles into the page cache without copying them, so that subsequent reads or mappings
+ * of the files do not wait for I/O. The files are loaded in the order of their positions in the HAP.
+ *
+ * @param mgr Input parameter. Pointer to the `NativeResourceManager` object.
+ * @param fileNames Input parameter. Pointer to the array of file paths relative to the `rawfile` root directory.
+ * @param count Input parameter. Number of paths in the array.
+ * @return **true** if the prefetch is submitted; **false** if `mgr` or `fileNames` is null.
+ * @since 26.1.0
+ * @version 1.0
+ */
+bool OH_ResourceManager_PrefetchRawFiles(const NativeResourceManager *mgr, const char *const *fileNames,
+    uint32_t count);
+
+/**
+ * @brief Creates a hash-indexed snapshot of all paths under the `rawfile` directory. The snapshot is built once per
+ * HAP and shared by later calls in the process. When the system has a prebuilt index for the HAP, the snapshot is
+ * memory-mapped from it instead of being built.
+ *
+ * @param mgr Input parameter. Pointer to the `NativeResourceManager` object.
+ * @return Pointer to the `RawFileIndex` object. If the call fails or `mgr` is null, `NULL` is returned. After use, call
+ *     {@link OH_ResourceManager_ReleaseRawFileIndex} to release it.
+ * @see {@link OH_ResourceManager_InitNativeResourceManager}
+ * @see {@link OH_ResourceManager_ReleaseRawFileIndex}
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileIndex *OH_ResourceManager_CreateRawFileIndex(const NativeResourceManager *mgr);
+
 #ifdef __cplusplus
 };
 #endif
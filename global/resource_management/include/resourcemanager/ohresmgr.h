@@ -983,6 +983,62 @@ ResourceManager_ErrorCode OH_ResourceManager_AddResource(const NativeResourceMan
  * @since 12
  */
 ResourceManager_ErrorCode OH_ResourceManager_RemoveResource(const NativeResourceManager *mgr, const char *path);
+
+/**
+ * @brief Resolves multiple resources for the current configuration in one pass. The configuration qualifiers are
+ * matched once for the whole batch instead of once per resource, and all strings are packed into a single allocation.
+ * <br>A failure of one resource does not affect the others. Check the `errorCode` of each item.
+ *
+ * @param mgr Input parameter. Pointer to the NativeResourceManager object. The pointer is obtained through
+ *     {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param items Input and output parameter. Pointer to the item array. `resId` and `type` of each item are input, and
+ *     `errorCode` and `value` are filled in.
+ * @param count Input parameter. Number of items in the array.
+ * @param stringPool Output parameter. Pointer to the memory that holds all string values of the batch, which is
+ *     allocated by **malloc()** and must be released via **free()** after use. It is set to `NULL` if the batch has
+ *     no string value.
+ * @return Result code.
+ *     <br>**SUCCESS**: Success. The result of each resource is returned in its `errorCode`.
+ *     <br>**ERROR_CODE_INVALID_INPUT_PARAMETER**: Invalid input parameter. Possible causes: 1. The parameter type is
+ *     incorrect. 2. Parameter verification failed.
+ *     <br>**ERROR_CODE_OUT_OF_MEMORY**: Memory overflow occurs.
+ * @since 26.1.0
+ */
+ResourceManager_ErrorCode OH_ResourceManager_ResolveBatch(const NativeResourceManager *mgr,
+    ResourceManager_BatchItem *items, uint32_t count, char **stringPool);
+
+/**
+ * @brief Sets the capacity of the resource lookup cache. The cache keeps the most recently resolved resource values,
+ * keyed by resource ID and configuration, and evicts the least recently used ones when full. It serves
+ * {@link OH_ResourceManager_ResolveBatch} and the getters such as {@link OH_ResourceManager_GetString} and
+ * {@link OH_ResourceManager_GetColor}, and is invalidated when the configuration changes or resources are added or
+ * removed.
+ *
+ * @param mgr Input parameter. Pointer to the NativeResourceManager object. The pointer is obtained through
+ *     {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @param capacity Input parameter. Maximum number of cached resource values. The value `0` disables the cache.
+ *     Default value: `0`.
+ * @return Result code.
+ *     <br>**SUCCESS**: Success.
+ *     <br>**ERROR_CODE_INVALID_INPUT_PARAMETER**: Invalid input parameter. Possible causes: 1. The parameter type is
+ *     incorrect. 2. Parameter verification failed.
+ * @since 26.1.0
+ */
+ResourceManager_ErrorCode OH_ResourceManager_SetCacheCapacity(const NativeResourceManager *mgr, uint32_t capacity);
+
+/**
+ * @brief Clears the resource lookup cache.
+ *
+ * @param mgr Input parameter. Pointer to the NativeResourceManager object. The pointer is obtained through
+ *     {@link OH_ResourceManager_InitNativeResourceManager}.
+ * @return Result code.
+ *     <br>**SUCCESS**: Success.
+ *     <br>**ERROR_CODE_INVALID_INPUT_PARAMETER**: Invalid input parameter. Possible causes: 1. The parameter type is
+ *     incorrect. 2. Parameter verification failed.
+ * @since 26.1.0
+ */
+ResourceManager_ErrorCode OH_ResourceManager_ClearCache(const NativeResourceManager *mgr);
+
 #ifdef __cplusplus
 };
 #endif
@@ -48,6 +48,7 @@
 #define GLOBAL_RESMGR_COMMON_H
 
 # include <stdint.h>
+# include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -252,6 +253,80 @@ typedef struct ResourceManager_Configuration {
      */
     uint32_t reserved[20];
 } ResourceManager_Configuration;
+
+/**
+ * @brief Enumerates the value types that can be resolved by {@link OH_ResourceManager_ResolveBatch}.
+ *
+ * @since 26.1.0
+ */
+typedef enum ResourceManager_ValueType {
+    /**
+     * String resource, resolved as by {@link OH_ResourceManager_GetString} without format arguments.
+     */
+    VALUE_TYPE_STRING = 0,
+    /**
+     * Color resource, resolved as by {@link OH_ResourceManager_GetColor}.
+     */
+    VALUE_TYPE_COLOR = 1,
+    /**
+     * Integer resource, resolved as by {@link OH_ResourceManager_GetInt}.
+     */
+    VALUE_TYPE_INT = 2,
+    /**
+     * Float resource, resolved as by {@link OH_ResourceManager_GetFloat}.
+     */
+    VALUE_TYPE_FLOAT = 3,
+    /**
+     * Boolean resource, resolved as by {@link OH_ResourceManager_GetBool}.
+     */
+    VALUE_TYPE_BOOL = 4,
+} ResourceManager_ValueType;
+
+/**
+ * @brief Structure of a resource to resolve in a batch.
+ *
+ * @since 26.1.0
+ */
+typedef struct ResourceManager_BatchItem {
+    /**
+     * Input. Resource ID.
+     */
+    uint32_t resId;
+    /**
+     * Input. Value type of the resource.
+     */
+    ResourceManager_ValueType type;
+    /**
+     * Output. Result code of the resource. The value of the resource is valid only if it is **SUCCESS**.
+     */
+    ResourceManager_ErrorCode errorCode;
+    /**
+     * Output. Value of the resource. The member used depends on `type`.
+     */
+    union {
+        /**
+         * String value, which points into the string pool returned by {@link OH_ResourceManager_ResolveBatch}.
+         */
+        const char* stringValue;
+        /**
+         * Color value.
+         */
+        uint32_t colorValue;
+        /**
+         * Integer value.
+         */
+        int intValue;
+        /**
+         * Float value.
+         */
+        float floatValue;
+        /**
+         * Boolean value.
+         */
+        bool boolValue;
+    } value;
+} ResourceManager_BatchItem;
+
 #ifdef __cplusplus
 };
 #endif
@@ -993,6 +993,246 @@ typedef enum OH_HiAppEvent_FrameworkType {
  */
 int OH_HiAppEvent_ReportFrameworkMemAnomaly(
     enum OH_HiAppEvent_FrameworkType frameworkType, const char* frameworkVersion, const char* description);
+
+/**
+ * @brief Creates a parameter list object backed by a preallocated arena. Parameters added to the list through the
+ * **OH_HiAppEvent_Add*Param** APIs are stored in the arena instead of being allocated one by one, and the arena grows
+ * only when it is exhausted. Together with {@link OH_HiAppEvent_ResetParamList}, the same list can be reused for many
+ * events without freeing and reallocating memory. Note: If the list is no longer used, destroy it by calling
+ * {@link OH_HiAppEvent_DestroyParamList}.
+ *
+ * @param arenaSize Initial arena size, in bytes. If the value is **0**, the default value **4096** is used.
+ * @return Pointer to the parameter list object; **NULL** if the memory fails to be allocated.
+ * @since 26.1.0
+ */
+ParamList OH_HiAppEvent_CreateParamListWithArena(uint32_t arenaSize);
+
+/**
+ * @brief Removes all parameters from a parameter list object so that it can be filled for the next event. For a list
+ * created by {@link OH_HiAppEvent_CreateParamListWithArena}, the arena memory is kept for reuse; for other lists, the
+ * parameter nodes are released.
+ *
+ * @param list Pointer to the parameter list object.
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} Operation successful.</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} The **list** parameter is null.</li>
+ *         </ul>
+ *     For details, see {@link HiAppEvent_ErrorCode}.
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_ResetParamList(ParamList list);
+
+/**
+ * @brief Defines a struct for a single event in a batch write.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_EventRecord {
+    /* The domain of the event. */
+    const char* domain;
+    /* The name of the event. */
+    const char* name;
+    /* The type of the event. */
+    enum EventType type;
+    /* The parameter list of the event. */
+    ParamList list;
+} HiAppEvent_EventRecord;
+
+/**
+ * @brief Logs multiple application events in one call. Each event is verified in the same way as
+ * {@link OH_HiAppEvent_Write}, then all accepted events are encoded in a compact binary format and submitted to the
+ * event file and the processors together, so the per-event submission cost is paid once per batch. The parameter
+ * lists can be reset and reused as soon as this API returns.
+ *
+ * @param records Array of events to log. For details, see {@link HiAppEvent_EventRecord}.
+ * @param count Number of events in **records**. The value ranges from 1 to 1000.
+ * @param results Array of **count** elements that receives the verification result of each event, with the same
+ *     values as those returned by {@link OH_HiAppEvent_Write}. The value can be **NULL** if the results are not needed.
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} The batch is submitted. Check **results** for events that were rejected or
+ *             written with invalid parameters discarded.</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} The **records** parameter is null or **count** is out of
+ *             range.</li>
+ *         <li>{@link HIAPPEVENT_OPERATE_FAILED} Application event logging is disabled or the batch fails to be
+ *             submitted.</li>
+ *         </ul>
+ *     For details, see {@link HiAppEvent_ErrorCode}.
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_WriteBatch(const HiAppEvent_EventRecord* records, uint32_t count, int* results);
+
+/**
+ * @brief Enumerates the value types of a column in a columnar event batch.
+ *
+ * @since 26.1.0
+ */
+typedef enum HiAppEvent_ColumnType {
+    /**
+     * Boolean values, stored in **bools**.
+     */
+    HIAPPEVENT_COLUMN_BOOL = 0,
+
+    /**
+     * Integer values of any width, stored in **ints**.
+     */
+    HIAPPEVENT_COLUMN_INT64 = 1,
+
+    /**
+     * Floating-point values of any width, stored in **doubles**.
+     */
+    HIAPPEVENT_COLUMN_DOUBLE = 2,
+
+    /**
+     * Strings, stored in **strings**.
+     */
+    HIAPPEVENT_COLUMN_STRING = 3,
+
+    /**
+     * Array parameters, stored in **strings** as JSON arrays.
+     */
+    HIAPPEVENT_COLUMN_ARRAY_JSON = 4
+} HiAppEvent_ColumnType;
+
+/**
+ * @brief Defines a column of a columnar event batch, that is, the values of one parameter for all events of the batch.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_Column {
+    /* The name of the parameter. */
+    const char* name;
+    /* The value type of the column. */
+    HiAppEvent_ColumnType type;
+    /* Whether each event of the batch carries the parameter. The value is NULL if every event carries it. */
+    const bool* present;
+    /* The values of the column, one per event. The member to read is given by type. */
+    union {
+        const bool* bools;
+        const int64_t* ints;
+        const double* doubles;
+        const char* const* strings;
+    } values;
+} HiAppEvent_Column;
+
+/**
+ * @brief Defines a columnar batch of events that share the same domain, name and type.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_EventBatch {
+    /* The domain of the events. */
+    const char* domain;
+    /* The name of the events. */
+    const char* name;
+    /* The type of the events. */
+    enum EventType type;
+    /* The number of events in the batch. */
+    uint32_t rowCount;
+    /* The time when each event was written, in ms since the epoch. */
+    const int64_t* timestamps;
+    /* The parameter columns of the batch. */
+    const HiAppEvent_Column* columns;
+    /* The length of the columns array. */
+    uint32_t columnCount;
+} HiAppEvent_EventBatch;
+
+/**
+ * @brief Passes columnar event batches to the caller. Note: The lifecycle of the objects pointed by the pointers in the
+ * callback is limited to the callback function. If the information needs to be cached, perform a deep copy.
+ *
+ * @param batches Array of event batches.
+ * @param batchLen Length of the batch array.
+ * @param arg Custom argument passed to {@link OH_HiAppEvent_SetWatcherOnReceiveBatch}.
+ * @since 26.1.0
+ */
+typedef void (*OH_HiAppEvent_OnReceiveBatch)(const HiAppEvent_EventBatch* batches, uint32_t batchLen, void* arg);
+
+/**
+ * @brief Defines the delivery metrics of a watcher.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_WatcherMetrics {
+    /* The number of events delivered to the watcher. */
+    uint64_t delivered;
+    /* The number of events dropped because the buffer of the watcher was full. */
+    uint64_t dropped;
+    /* The number of events currently waiting for credit. */
+    uint32_t buffered;
+    /* The remaining credit of the watcher, in events. */
+    uint32_t credit;
+    /* The average time from event write to delivery, in microseconds. */
+    uint64_t avgLatencyUs;
+    /* The maximum time from event write to delivery, in microseconds. */
+    uint64_t maxLatencyUs;
+} HiAppEvent_WatcherMetrics;
+
+/**
+ * @brief Sets the **onReceiveBatch** callback. Events received by the watcher are grouped by domain, name and type and
+ * delivered as typed columns, without converting them to JSON. If this callback is set, the
+ * {@link OH_HiAppEvent_OnReceive} callback of the watcher is not called.
+ * <br>Delivery is flow-controlled by credit: each delivered event consumes one credit, and events received while the
+ * watcher has no credit are buffered until {@link OH_HiAppEvent_GrantWatcherCredit} is called. A watcher starts with
+ * unlimited credit until credit is granted for the first time.
+ *
+ * @param watcher Pointer to the watcher (that is, the pointer returned by {@link OH_HiAppEvent_CreateWatcher}).
+ * @param onReceiveBatch Pointer to the callback function.
+ * @param arg Custom argument passed to the callback.
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} Operation successful.</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} The **watcher** or **onReceiveBatch** parameter is null.</li>
+ *         </ul>
+ *     For details, see {@link HiAppEvent_ErrorCode}.
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_SetWatcherOnReceiveBatch(HiAppEvent_Watcher* watcher, OH_HiAppEvent_OnReceiveBatch onReceiveBatch,
+    void* arg);
+
+/**
+ * @brief Grants delivery credit to a watcher. Buffered events are delivered immediately, up to the granted credit.
+ *
+ * @param watcher Pointer to the watcher (that is, the pointer returned by {@link OH_HiAppEvent_CreateWatcher}).
+ * @param events Number of events that may be delivered, which is added to the remaining credit.
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} Operation successful.</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} The **watcher** parameter is null.</li>
+ *         </ul>
+ *     For details, see {@link HiAppEvent_ErrorCode}.
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_GrantWatcherCredit(HiAppEvent_Watcher* watcher, uint32_t events);
+
+/**
+ * @brief Sets the maximum number of events buffered for a watcher while it has no credit. When the buffer is full,
+ * the oldest buffered events are dropped and counted in {@link HiAppEvent_WatcherMetrics}.
+ *
+ * @param watcher Pointer to the watcher (that is, the pointer returned by {@link OH_HiAppEvent_CreateWatcher}).
+ * @param maxEvents Maximum number of buffered events. The value ranges from 1 to 100000. The default value is
+ *     **10000**.
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} Operation successful.</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} The **watcher** parameter is null or **maxEvents** is out of
+ *             range.</li>
+ *         </ul>
+ *     For details, see {@link HiAppEvent_ErrorCode}.
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_SetWatcherBufferLimit(HiAppEvent_Watcher* watcher, uint32_t maxEvents);
+
+/**
+ * @brief Obtains the delivery metrics of a watcher.
+ *
+ * @param watcher Pointer to the watcher (that is, the pointer returned by {@link OH_HiAppEvent_CreateWatcher}).
+ * @param metrics Pointer to {@link HiAppEvent_WatcherMetrics}, which receives the metrics.
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} Operation successful.</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} The **watcher** or **metrics** parameter is null.</li>
+ *         </ul>
+ *     For details, see {@link HiAppEvent_ErrorCode}.
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_GetWatcherMetrics(HiAppEvent_Watcher* watcher, HiAppEvent_WatcherMetrics* metrics);
+
 #ifdef __cplusplus
 }
 #endif
@@ -449,6 +449,189 @@ void* OH_HiCollie_SetFreezeCallback(OH_HiCollie_FreezeCallback callback);
  * @since 24
  */
 HiCollie_ErrorCode OH_HiCollie_AssociateProcessReport(bool isFreezeEvent);
+
+/**
+ * @brief Defines the parameters of the latency histogram detection.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiCollie_LatencyHistogramParam {
+    /**
+     * Task duration, in ms, above which a task is reported as a jank. The value ranges from 16 to 6000.
+     *
+     * @since 26.1.0
+     */
+    uint32_t jankThresholdMs;
+    /**
+     * Highest task duration, in ms, tracked with full precision. Longer tasks are recorded in the last bucket. The
+     * value **0** means the default value **60000**.
+     *
+     * @since 26.1.0
+     */
+    uint32_t maxTrackableMs;
+    /**
+     * Number of significant decimal digits kept for each recorded duration. The value ranges from 1 to 3. If the value
+     * is out of the range, the default value **2** is used, which bounds the relative error of percentiles to 1%.
+     *
+     * @since 26.1.0
+     */
+    uint32_t significantDigits;
+    /**
+     * Whether to capture the stack of a task that exceeds **jankThresholdMs**. The stack is sampled while the task is
+     * still running, using the lite sampling of HiDebug.
+     *
+     * @since 26.1.0
+     */
+    bool captureBacktrace;
+    /**
+     * Extended parameter for future use. Set it to **0**.
+     *
+     * @since 26.1.0
+     */
+    int reserved;
+} HiCollie_LatencyHistogramParam;
+
+/**
+ * @brief Defines the information of a jank detected by the latency histogram detection.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiCollie_JankInfo {
+    /**
+     * Name of the event passed to the begin function of the task.
+     *
+     * @since 26.1.0
+     */
+    const char* eventName;
+    /**
+     * Duration of the task, in microseconds.
+     *
+     * @since 26.1.0
+     */
+    uint64_t durationUs;
+    /**
+     * Sampled stack of the task. The value is NULL if the stack is not captured.
+     *
+     * @since 26.1.0
+     */
+    const char* backtrace;
+} HiCollie_JankInfo;
+
+/**
+ * @brief Called on a HiCollie thread each time the latency histogram detection detects a jank. The information is
+ * valid only during the execution of this callback.
+ *
+ * @param info Jank information. For details, see {@link HiCollie_JankInfo}.
+ * @since 26.1.0
+ */
+typedef void (*OH_HiCollie_JankCallback)(const HiCollie_JankInfo* info);
+
+/**
+ * @brief Defines the latency summary of the tasks recorded by the latency histogram detection.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiCollie_LatencySummary {
+    /**
+     * Number of recorded tasks.
+     *
+     * @since 26.1.0
+     */
+    uint64_t count;
+    /**
+     * Number of tasks reported as jank.
+     *
+     * @since 26.1.0
+     */
+    uint64_t jankCount;
+    /**
+     * Median task duration, in microseconds.
+     *
+     * @since 26.1.0
+     */
+    uint64_t p50Us;
+    /**
+     * 99th percentile task duration, in microseconds.
+     *
+     * @since 26.1.0
+     */
+    uint64_t p99Us;
+    /**
+     * 99.9th percentile task duration, in microseconds.
+     *
+     * @since 26.1.0
+     */
+    uint64_t p999Us;
+    /**
+     * Maximum task duration, in microseconds.
+     *
+     * @since 26.1.0
+     */
+    uint64_t maxUs;
+} HiCollie_LatencySummary;
+
+/**
+ * @brief Registers the latency histogram detection for the calling thread. Like
+ * {@link OH_HiCollie_Init_JankDetection}, it provides two instrumentation functions to be called before and after each
+ * task of the thread. In addition to reporting janks, the duration of every task is recorded in a histogram with
+ * bounded relative error, so that percentiles can be queried at any time without storing individual samples.
+ * <br>Unlike {@link OH_HiCollie_Init_JankDetection}, this function is intended for the main thread and can be called
+ * on it; it can also be called on a service thread. A process has one latency histogram, which is bound to the first
+ * thread that calls this function successfully. Calling it again on the same thread updates **param** and
+ * **callback** and keeps the recorded durations; calling it on another thread fails. The instrumentation functions
+ * record nothing when they are called on a thread other than the bound one.
+ *
+ * @param beginFunc Function to be called before each task.
+ * @param endFunc Function to be called after each task.
+ * @param param Detection parameters. For details, see {@link HiCollie_LatencyHistogramParam}.
+ * @param callback Callback invoked for each jank. The value can be NULL if janks only need to be counted.
+ * @return {@link HICOLLIE_SUCCESS} 0 - Operation successful.
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - beginFunc or endFunc is null, or a parameter is out of range.
+ * {@link HICOLLIE_WRONG_THREAD_CONTEXT} 29800001 - Incorrect calling thread. The detection has already been
+ * initialized on another thread of the process.
+ * For details, see {@link HiCollie_ErrorCode}.
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_Init_LatencyHistogram(OH_HiCollie_BeginFunc* beginFunc,
+    OH_HiCollie_EndFunc* endFunc, HiCollie_LatencyHistogramParam param, OH_HiCollie_JankCallback callback);
+
+/**
+ * @brief Obtains a percentile of the task durations recorded by the latency histogram detection. The process has one
+ * histogram, so this function can be called on any thread.
+ *
+ * @param percentile Percentile to query. The value ranges from 0 to 100, for example, **99.9**.
+ * @param valueUs Pointer to the task duration at the percentile, in microseconds.
+ * @return {@link HICOLLIE_SUCCESS} 0 - Operation successful.
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - percentile is out of range, valueUs is null, or the detection is not
+ * initialized.
+ * For details, see {@link HiCollie_ErrorCode}.
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_GetLatencyPercentile(double percentile, uint64_t* valueUs);
+
+/**
+ * @brief Obtains the latency summary of the tasks recorded by the latency histogram detection. The process has one
+ * histogram, so this function can be called on any thread.
+ *
+ * @param summary Pointer to {@link HiCollie_LatencySummary}.
+ * @return {@link HICOLLIE_SUCCESS} 0 - Operation successful.
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - summary is null or the detection is not initialized.
+ * For details, see {@link HiCollie_ErrorCode}.
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_GetLatencySummary(HiCollie_LatencySummary* summary);
+
+/**
+ * @brief Clears the histogram of the latency histogram detection, for example, at the start of a measurement window.
+ * The process has one histogram, so this function can be called on any thread. The thread binding is kept.
+ *
+ * @return {@link HICOLLIE_SUCCESS} 0 - Operation successful.
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - The detection is not initialized.
+ * For details, see {@link HiCollie_ErrorCode}.
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_ResetLatencyHistogram(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -615,6 +615,281 @@ HiDebug_ErrorCode OH_HiDebug_SetMaxDurationSec(OH_HiDebug_ProfilerOptions *opts,
 HiDebug_ErrorCode OH_HiDebug_StartProfilerWithOptions(OH_HiDebug_ResourceType type,
     OH_HiDebug_ProfilerOptions *opts, OH_HiDebug_ProfilingCallback callback);
 
+/**
+ * @brief Creates a continuous CPU profiler for the current process. The profiler samples the configured threads at a
+ * low frequency, unwinds their stacks by frame pointer and aggregates the samples by stack in memory, so that it can
+ * stay enabled in production and the profile can be exported when needed.
+ *
+ * @param config [in] Pointer to {@link HiDebug_CpuProfilerConfig}. If NULL is passed, the default configuration is
+ *     used.
+ * @return Pointer to the created profiler. If the profiler fails to be created, NULL is returned.
+ * @release hidebug/OH_HiDebug_DestroyCpuProfiler {return}
+ * @since 26.1.0
+ */
+HiDebug_CpuProfiler *OH_HiDebug_CreateCpuProfiler(const HiDebug_CpuProfilerConfig *config);
+
+/**
+ * @brief Destroys a continuous CPU profiler. If the profiler is running, it is stopped first and the aggregated
+ * samples are discarded.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateCpuProfiler}.
+ * @since 26.1.0
+ */
+void OH_HiDebug_DestroyCpuProfiler(HiDebug_CpuProfiler *profiler);
+
+/**
+ * @brief Starts a continuous CPU profiler. Samples keep being aggregated until {@link OH_HiDebug_StopCpuProfiler} is
+ * called. Only one continuous CPU profiler can run in a process at a time.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateCpuProfiler}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer.</li>
+ *     <li>{@link HIDEBUG_NOT_SUPPORTED} Continuous CPU profiling is not supported.</li>
+ *     <li>{@link HIDEBUG_UNDER_SAMPLING} Another continuous CPU profiler is running.</li>
+ *     <li>{@link HIDEBUG_RESOURCE_UNAVAILABLE} Sampling resources are insufficient.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StartCpuProfiler(HiDebug_CpuProfiler *profiler);
+
+/**
+ * @brief Stops a continuous CPU profiler. The aggregated samples are kept and can still be exported.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateCpuProfiler}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer or is not running.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StopCpuProfiler(HiDebug_CpuProfiler *profiler);
+
+/**
+ * @brief Exports the samples aggregated by a continuous CPU profiler. The frames are symbolized during export, so
+ * the sampling path never performs symbol lookup. This API can be called while the profiler is running. Note that this
+ * API involves I/O operations and symbol parsing. Therefore, you are advised not to call this API in the main thread.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateCpuProfiler}.
+ * @param format [in] Output format. For details, see {@link HiDebug_CpuProfileFormat}.
+ * @param fd [in] Writable file descriptor to which the profile is written. The FD is not closed by this API.
+ * @param reset [in] Whether to clear the aggregated samples after the export, so that the next export only covers
+ *     the samples collected afterwards.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer, format is invalid or fd is invalid.</li>
+ *     <li>{@link HIDEBUG_TRACE_ABNORMAL} Failed to write the profile.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ExportCpuProfile(HiDebug_CpuProfiler *profiler, HiDebug_CpuProfileFormat format,
+    int32_t fd, bool reset);
+
+/**
+ * @brief Obtains the statistics of a continuous CPU profiler.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateCpuProfiler}.
+ * @param stats [out] Pointer to {@link HiDebug_CpuProfilerStats}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler or stats is a null pointer.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_GetCpuProfilerStats(HiDebug_CpuProfiler *profiler, HiDebug_CpuProfilerStats *stats);
+
+/**
+ * @brief Creates a sampling heap profiler for the current process. Once started, the profiler hooks the memory
+ * operation functions through the MallocDispatch table, samples allocations by bytes, captures their call stacks by
+ * frame pointer and aggregates live and total bytes per stack.
+ *
+ * @param config [in] Pointer to {@link HiDebug_HeapProfilerConfig}. If NULL is passed, the default configuration is
+ *     used.
+ * @return Pointer to the created profiler. If the profiler fails to be created, NULL is returned.
+ * @release hidebug/OH_HiDebug_DestroyHeapProfiler {return}
+ * @since 26.1.0
+ */
+HiDebug_HeapProfiler *OH_HiDebug_CreateHeapProfiler(const HiDebug_HeapProfilerConfig *config);
+
+/**
+ * @brief Destroys a sampling heap profiler. If the profiler is running, it is stopped first and the aggregated
+ * samples are discarded.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @since 26.1.0
+ */
+void OH_HiDebug_DestroyHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief Starts a sampling heap profiler by installing its MallocDispatch table. Only one sampling heap profiler can
+ * run in a process at a time, and it cannot run while a custom table set by {@link OH_HiDebug_SetMallocDispatchTable}
+ * is in use.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer.</li>
+ *     <li>{@link HIDEBUG_NOT_SUPPORTED} Heap profiling is not supported.</li>
+ *     <li>{@link HIDEBUG_UNDER_SAMPLING} Another heap profiler or custom MallocDispatch table is in use.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StartHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief Stops a sampling heap profiler and restores the MallocDispatch table of the system C library. The aggregated
+ * samples are kept and can still be queried or exported. Frees of sampled blocks after this call are no longer
+ * tracked, so the live bytes stay frozen at the values of the stop time.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer or is not running.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StopHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief Clears the total bytes and counts aggregated by a sampling heap profiler. Live bytes are kept, because the
+ * blocks they describe are still allocated.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ResetHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief Obtains the statistics of a sampling heap profiler.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @param stats [out] Pointer to {@link HiDebug_HeapProfilerStats}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler or stats is a null pointer.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_GetHeapProfilerStats(HiDebug_HeapProfiler *profiler, HiDebug_HeapProfilerStats *stats);
+
+/**
+ * @brief Traverses the allocation stacks recorded by a sampling heap profiler, for example to assert on allocation
+ * regressions in tests. Allocations made inside the callback are not sampled.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @param callback [in] Callback invoked for each allocation stack.
+ * @param arg [in] Custom argument passed to the callback.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler or callback is a null pointer.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ForEachHeapProfileEntry(HiDebug_HeapProfiler *profiler,
+    OH_HiDebug_HeapProfileEntryCallback callback, void *arg);
+
+/**
+ * @brief Exports the samples aggregated by a sampling heap profiler in gzip-compressed pprof format, with the
+ * alloc_space, alloc_objects, inuse_space and inuse_objects sample types. Note that this API involves I/O operations
+ * and symbol parsing. Therefore, you are advised not to call this API in the main thread.
+ *
+ * @param profiler [in] Profiler created by {@link OH_HiDebug_CreateHeapProfiler}.
+ * @param fd [in] Writable file descriptor to which the profile is written. The FD is not closed by this API.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler is a null pointer or fd is invalid.</li>
+ *     <li>{@link HIDEBUG_TRACE_ABNORMAL} Failed to write the profile.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ExportHeapProfile(HiDebug_HeapProfiler *profiler, int32_t fd);
+
+/**
+ * @brief Subscribes to memory statistics of the current process. The subscribed fields are sampled at the configured
+ * interval on a shared background thread, and the callback is invoked only when at least one field has changed. A
+ * maximum of 8 subscriptions can exist in a process at the same time.
+ *
+ * @param config [in] Pointer to {@link HiDebug_MemorySubscribeConfig}.
+ * @param callback [in] Callback invoked with the changed fields. See {@link OH_HiDebug_MemorySubscribeCallback}.
+ * @param arg [in] Custom argument passed to the callback.
+ * @param subscriptionId [out] ID of the subscription, which is used to cancel the subscription or read the latest
+ *     snapshot.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} config, callback or subscriptionId is a null pointer, or no field is
+ *     subscribed.</li>
+ *     <li>{@link HIDEBUG_RESOURCE_UNAVAILABLE} The maximum number of subscriptions is reached.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_SubscribeMemory(const HiDebug_MemorySubscribeConfig *config,
+    OH_HiDebug_MemorySubscribeCallback callback, void *arg, uint32_t *subscriptionId);
+
+/**
+ * @brief Cancels a memory subscription. After this API returns, the callback of the subscription is no longer invoked.
+ * This API must not be called from the callback of the same subscription.
+ *
+ * @param subscriptionId [in] ID obtained by {@link OH_HiDebug_SubscribeMemory}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} The subscription does not exist.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_UnsubscribeMemory(uint32_t subscriptionId);
+
+/**
+ * @brief Obtains the latest snapshot delivered for a memory subscription. This API only copies the cached snapshot and
+ * does not read any /proc node, so it can be polled cheaply from any thread. The result is identical to the snapshot
+ * last passed to the callback, so its **changedFields** member has the same meaning as in the callback: the fields
+ * changed since the delivery before it.
+ *
+ * @param subscriptionId [in] ID obtained by {@link OH_HiDebug_SubscribeMemory}.
+ * @param snapshot [out] Pointer to {@link HiDebug_MemorySnapshot}.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} snapshot is a null pointer or the subscription does not exist.</li>
+ *     <li>{@link HIDEBUG_RESOURCE_UNAVAILABLE} No snapshot has been delivered yet.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_GetLatestMemorySnapshot(uint32_t subscriptionId, HiDebug_MemorySnapshot *snapshot);
+
+/**
+ * @brief Creates a thread CPU tracker for the current process. Unlike {@link OH_HiDebug_GetAppThreadCpuUsage}, the
+ * tracker keeps the stat node of each thread open and only re-reads them on update, and it rescans the thread list of
+ * the process at most once per **rescanIntervalMs** to discover new threads. Exited threads are dropped when their
+ * node can no longer be read.
+ *
+ * @param rescanIntervalMs [in] Minimum interval between two thread list rescans, in ms. The value **0** means that
+ *     the thread list is rescanned on every update.
+ * @return Pointer to the created tracker. If the tracker fails to be created, NULL is returned.
+ * @release hidebug/OH_HiDebug_DestroyThreadCpuTracker {return}
+ * @since 26.1.0
+ */
+HiDebug_ThreadCpuTracker *OH_HiDebug_CreateThreadCpuTracker(uint32_t rescanIntervalMs);
+
+/**
+ * @brief Destroys a thread CPU tracker and closes the file descriptors held by it.
+ *
+ * @param tracker [in] Tracker created by {@link OH_HiDebug_CreateThreadCpuTracker}.
+ * @since 26.1.0
+ */
+void OH_HiDebug_DestroyThreadCpuTracker(HiDebug_ThreadCpuTracker *tracker);
+
+/**
+ * @brief Updates a thread CPU tracker and writes the CPU usage of each thread since the previous update into the
+ * caller-provided array. An update that does not rescan the thread list allocates no memory. An update that rescans
+ * it, as determined by **rescanIntervalMs**, may allocate memory to track newly discovered threads. The first update
+ * after creation only records the baseline and reports no thread. A tracker must not be updated from multiple threads
+ * at the same time.
+ *
+ * @param tracker [in] Tracker created by {@link OH_HiDebug_CreateThreadCpuTracker}.
+ * @param samples [out] Array to which the per-thread results are written.
+ * @param capacity [in] Number of elements in **samples**.
+ * @param count [out] Number of threads tracked. If the value is greater than **capacity**, only the first **capacity**
+ *     threads are written, and the caller can retry with a larger array.
+ * @return Result code.
+ *     <ul><li>{@link HIDEBUG_SUCCESS} Success.</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} tracker or count is a null pointer, or samples is a null pointer while
+ *     capacity is not 0.</li>
+ *     <li>{@link HIDEBUG_TRACE_ABNORMAL} Failed to read the thread information.</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_UpdateThreadCpuTracker(HiDebug_ThreadCpuTracker *tracker,
+    HiDebug_ThreadCpuSample *samples, uint32_t capacity, uint32_t *count);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -774,6 +774,382 @@ typedef enum OH_HiDebug_MemListenerType {
     OH_HIDEBUG_DUMP_SNAPSHOT = 2
 } OH_HiDebug_MemListenerType;
 
+/**
+ * @brief Defines an enum for the threads covered by the continuous CPU profiler.
+ *
+ * @since 26.1.0
+ */
+typedef enum HiDebug_CpuProfilerThreadMode {
+    /**
+     * Sample all threads of the current process.
+     */
+    HIDEBUG_CPU_PROFILER_ALL_THREADS = 0,
+
+    /**
+     * Sample only the main thread of the current process.
+     */
+    HIDEBUG_CPU_PROFILER_MAIN_THREAD = 1
+} HiDebug_CpuProfilerThreadMode;
+
+/**
+ * @brief Defines an enum for the output formats of the continuous CPU profiler.
+ *
+ * @since 26.1.0
+ */
+typedef enum HiDebug_CpuProfileFormat {
+    /**
+     * Folded stacks, one line per unique stack, with frames separated by semicolons and followed by the sample
+     * count. The output can be passed directly to flame graph tools.
+     */
+    HIDEBUG_CPU_PROFILE_FORMAT_FOLDED = 0,
+
+    /**
+     * Gzip-compressed pprof protobuf.
+     */
+    HIDEBUG_CPU_PROFILE_FORMAT_PPROF = 1
+} HiDebug_CpuProfileFormat;
+
+/**
+ * @brief Defines a struct for the continuous CPU profiler configuration.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_CpuProfilerConfig {
+    /**
+     * Sampling frequency, in Hz. The value ranges from 1 to 100. If the value is out of the range, the default value
+     * **10** is used.
+     */
+    uint32_t frequency;
+
+    /**
+     * Maximum number of frames recorded per sample. The value ranges from 1 to 128. If the value is out of the range,
+     * the default value **64** is used.
+     */
+    uint32_t maxStackDepth;
+
+    /**
+     * Threads to sample. For details, see {@link HiDebug_CpuProfilerThreadMode}.
+     */
+    HiDebug_CpuProfilerThreadMode threadMode;
+
+    /**
+     * Maximum number of unique stacks kept in memory. Samples whose stack is not yet recorded are counted as dropped
+     * once the limit is reached. The value **0** means the default value **4096**.
+     */
+    uint32_t maxUniqueStacks;
+} HiDebug_CpuProfilerConfig;
+
+/**
+ * @brief Defines a struct for the statistics of the continuous CPU profiler.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_CpuProfilerStats {
+    /**
+     * Number of samples aggregated since the profiler was started or last reset.
+     */
+    uint64_t samples;
+
+    /**
+     * Number of samples dropped because the stack table was full or the thread could not be unwound.
+     */
+    uint64_t droppedSamples;
+
+    /**
+     * Number of unique stacks currently held in memory.
+     */
+    uint32_t uniqueStacks;
+
+    /**
+     * CPU time spent on sampling and aggregation, in microseconds.
+     */
+    uint64_t overheadUs;
+} HiDebug_CpuProfilerStats;
+
+/**
+ * @brief Defines the continuous CPU profiler object.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_CpuProfiler HiDebug_CpuProfiler;
+
+/**
+ * @brief Defines a struct for the sampling heap profiler configuration.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfilerConfig {
+    /**
+     * Mean sampling interval, in bytes. Allocations are sampled by a Poisson process over the allocated bytes, so an
+     * allocation of size s is sampled with the probability 1 - e^(-s / sampleIntervalBytes). The probability is
+     * about s / sampleIntervalBytes for allocations much smaller than the interval, about 63% for an allocation equal
+     * to the interval, and approaches 100% for larger allocations. The value **0** means the default value
+     * **524288**.
+     */
+    uint32_t sampleIntervalBytes;
+
+    /**
+     * Maximum number of frames recorded per sampled allocation. The value ranges from 1 to 128. If the value is out of
+     * the range, the default value **64** is used.
+     */
+    uint32_t maxStackDepth;
+
+    /**
+     * Maximum number of unique allocation stacks kept in memory. Samples whose stack is not yet recorded are counted as
+     * dropped once the limit is reached. The value **0** means the default value **4096**.
+     */
+    uint32_t maxUniqueStacks;
+} HiDebug_HeapProfilerConfig;
+
+/**
+ * @brief Defines a struct for the allocation statistics aggregated for one call stack by the sampling heap profiler.
+ * The byte and count values are scaled estimates of the unsampled totals.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfileEntry {
+    /**
+     * PC addresses of the allocation call stack, innermost frame first. The addresses can be passed to
+     * {@link OH_HiDebug_SymbolicAddress}.
+     */
+    void* const* pcs;
+
+    /**
+     * Number of elements in **pcs**.
+     */
+    uint32_t depth;
+
+    /**
+     * Estimated number of bytes allocated from this stack and not yet freed.
+     */
+    uint64_t liveBytes;
+
+    /**
+     * Estimated number of allocations from this stack not yet freed.
+     */
+    uint64_t liveCount;
+
+    /**
+     * Estimated number of bytes allocated from this stack since the profiler was started or last reset.
+     */
+    uint64_t totalBytes;
+
+    /**
+     * Estimated number of allocations from this stack since the profiler was started or last reset.
+     */
+    uint64_t totalCount;
+} HiDebug_HeapProfileEntry;
+
+/**
+ * @brief Defines a struct for the statistics of the sampling heap profiler.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfilerStats {
+    /**
+     * Number of allocations that were sampled.
+     */
+    uint64_t sampledAllocations;
+
+    /**
+     * Number of samples dropped because the stack table was full.
+     */
+    uint64_t droppedSamples;
+
+    /**
+     * Number of unique allocation stacks currently held in memory.
+     */
+    uint32_t uniqueStacks;
+
+    /**
+     * Estimated number of bytes allocated and not yet freed, summed over all stacks.
+     */
+    uint64_t liveBytes;
+
+    /**
+     * Estimated number of bytes allocated since the profiler was started or last reset, summed over all stacks.
+     */
+    uint64_t totalBytes;
+} HiDebug_HeapProfilerStats;
+
+/**
+ * @brief Called for each allocation stack recorded by the sampling heap profiler. The entry is valid only during the
+ * execution of this callback.
+ *
+ * @param entry Allocation statistics of one call stack. For details, see {@link HiDebug_HeapProfileEntry}.
+ * @param arg Custom argument passed to {@link OH_HiDebug_ForEachHeapProfileEntry}.
+ * @return Returns **true** to continue the iteration; returns **false** to stop it.
+ * @since 26.1.0
+ */
+typedef bool (*OH_HiDebug_HeapProfileEntryCallback)(const HiDebug_HeapProfileEntry* entry, void* arg);
+
+/**
+ * @brief Defines the sampling heap profiler object.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfiler HiDebug_HeapProfiler;
+
+/**
+ * @brief Defines an enum for the memory fields that can be subscribed to. The values can be combined with bitwise OR.
+ *
+ * @since 26.1.0
+ */
+typedef enum HiDebug_MemoryField {
+    /**
+     * Proportional set size of the process.
+     */
+    HIDEBUG_MEMORY_FIELD_PSS = 1 << 0,
+
+    /**
+     * Resident set size of the process.
+     */
+    HIDEBUG_MEMORY_FIELD_RSS = 1 << 1,
+
+    /**
+     * Swapped-out memory of the process.
+     */
+    HIDEBUG_MEMORY_FIELD_SWAP = 1 << 2,
+
+    /**
+     * Graphics memory of the process, that is, the sum of the values in {@link HiDebug_GraphicsMemorySummary}.
+     */
+    HIDEBUG_MEMORY_FIELD_GRAPHICS = 1 << 3
+} HiDebug_MemoryField;
+
+/**
+ * @brief Defines a struct for the memory subscription configuration.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_MemorySubscribeConfig {
+    /**
+     * Sampling interval, in ms. The value ranges from 100 to 60000. If the value is out of the range, the default value
+     * **1000** is used.
+     */
+    uint32_t intervalMs;
+
+    /**
+     * Fields to sample, which is a combination of {@link HiDebug_MemoryField} values. The value **0** is invalid.
+     */
+    uint32_t fields;
+
+    /**
+     * Number of recent samples over which the minimum, maximum and average values are computed. The value **0** means
+     * the default value **60**.
+     */
+    uint32_t windowSize;
+
+    /**
+     * Minimum change, in KB, for a field to be reported as changed. The value **0** means that any change is reported.
+     */
+    uint32_t changeThresholdKb;
+} HiDebug_MemorySubscribeConfig;
+
+/**
+ * @brief Defines a struct for the statistics of one memory field over the subscription window.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_MemoryFieldStats {
+    /**
+     * Latest sampled value, in KB.
+     */
+    uint32_t current;
+
+    /**
+     * Minimum value in the window, in KB.
+     */
+    uint32_t min;
+
+    /**
+     * Maximum value in the window, in KB.
+     */
+    uint32_t max;
+
+    /**
+     * Average value in the window, in KB.
+     */
+    uint32_t avg;
+} HiDebug_MemoryFieldStats;
+
+/**
+ * @brief Defines a struct for a memory sample delivered to a subscriber.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_MemorySnapshot {
+    /**
+     * Time when the sample was taken, in ms since boot.
+     */
+    uint64_t timestampMs;
+
+    /**
+     * Fields whose value changed since the previous delivery, which is a combination of {@link HiDebug_MemoryField}
+     * values. Only these fields need to be read; the other fields keep the values of the previous delivery.
+     */
+    uint32_t changedFields;
+
+    /**
+     * Proportional set size statistics.
+     */
+    HiDebug_MemoryFieldStats pss;
+
+    /**
+     * Resident set size statistics.
+     */
+    HiDebug_MemoryFieldStats rss;
+
+    /**
+     * Swap statistics.
+     */
+    HiDebug_MemoryFieldStats swap;
+
+    /**
+     * Graphics memory statistics.
+     */
+    HiDebug_MemoryFieldStats graphics;
+} HiDebug_MemorySnapshot;
+
+/**
+ * @brief Called on the sampling thread when at least one subscribed memory field has changed. The snapshot is valid
+ * only during the execution of this callback.
+ *
+ * @param snapshot Memory sample. For details, see {@link HiDebug_MemorySnapshot}.
+ * @param arg Custom argument passed to {@link OH_HiDebug_SubscribeMemory}.
+ * @since 26.1.0
+ */
+typedef void (*OH_HiDebug_MemorySubscribeCallback)(const HiDebug_MemorySnapshot* snapshot, void* arg);
+
+/**
+ * @brief Defines a struct for the CPU usage of a thread computed by the thread CPU tracker.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_ThreadCpuSample {
+    /**
+     * Thread ID.
+     */
+    uint32_t threadId;
+
+    /**
+     * Thread CPU usage between the two latest updates, in percentage.
+     */
+    double cpuUsage;
+
+    /**
+     * CPU time consumed by the thread between the two latest updates, in microseconds.
+     */
+    uint64_t cpuTimeUs;
+} HiDebug_ThreadCpuSample;
+
+/**
+ * @brief Defines the thread CPU tracker object.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_ThreadCpuTracker HiDebug_ThreadCpuTracker;
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -253,12 +253,55 @@ int OH_LOG_VPrint(LogType type, LogLevel level, unsigned int domain, const char
  */
 bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
 
+/**
+ * @brief Defines the lowest log level that may be output by the current process.
+ *
+ * The value is maintained by HiLog and is updated when the system log level, {@link OH_LOG_SetMinLogLevel} or
+ * {@link OH_LOG_SetLogLevel} changes. It is the lowest level loggable for any service domain and log tag, so a log
+ * below it is never output, while a log at or above it is still checked by {@link OH_LOG_Print}. It is read by
+ * {@link OH_LOG_IsLevelEnabled} and must not be modified. The symbol is weak so that applications built with this
+ * header keep running on systems that do not provide it. \n
+ *
+ * @since 26.1.0
+ */
+extern const volatile int OH_LOG_LowestLevel __attribute__((weak));
+
+/**
+ * @brief Defines the lowest log level compiled into the current source file.
+ *
+ * Calls of {@link OH_LOG_DEBUG}, {@link OH_LOG_INFO}, {@link OH_LOG_WARN}, {@link OH_LOG_ERROR} and
+ * {@link OH_LOG_FATAL} below this level are removed at compile time, and their parameters are not evaluated.
+ * Define it before including this header, for example <b>#define HILOG_MIN_LEVEL LOG_INFO</b>. The default value is
+ * <b>LOG_DEBUG</b>, which keeps all levels. \n
+ *
+ * @since 26.1.0
+ */
+#ifndef HILOG_MIN_LEVEL
+#define HILOG_MIN_LEVEL LOG_DEBUG
+#endif
+
+/**
+ * @brief Checks whether logs of the specified level may be output. This is a function-like macro.
+ *
+ * The check is resolved at compile time against {@link HILOG_MIN_LEVEL}, and otherwise costs one comparison against
+ * {@link OH_LOG_LowestLevel} without a function call. A <b>true</b> result does not guarantee that the log is
+ * output for every service domain and log tag; use {@link OH_LOG_IsLoggable} for an exact check. \n
+ *
+ * @param level Indicates the log level.
+ * @return Returns <b>false</b> if logs of the specified level cannot be output; returns <b>true</b> otherwise.
+ * @since 26.1.0
+ */
+#define OH_LOG_IsLevelEnabled(level) \
+    ((level) >= HILOG_MIN_LEVEL && (&OH_LOG_LowestLevel == NULL || (int)(level) >= OH_LOG_LowestLevel))
+
 /**
  * @brief Outputs debug logs. This is a function-like macro.
  *
  * Before calling this function, define the log service domain and log tag. Generally, you need to define them at
  * the beginning of the source file. \n
  *
+ * The parameters are evaluated only if {@link OH_LOG_IsLevelEnabled} is true for the level. \n
+ *
  * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
  * @param fmt Indicates the format string, which is an enhancement of a printf format string and supports the
  * privacy identifier. Specifically, {public} or {private} is added between the % character and the format specifier
@@ -268,7 +311,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_DEBUG(type, ...) ((void)OH_LOG_Print((type), LOG_DEBUG, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_DEBUG(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_DEBUG) && \
+    HILOG_PRINT((type), LOG_DEBUG, __VA_ARGS__)))
 
 /**
  * @brief Outputs informational logs. This is a function-like macro.
@@ -276,6 +320,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * Before calling this function, define the log service domain and log tag. Generally, you need to define them
  * at the beginning of the source file. \n
  *
+ * The parameters are evaluated only if {@link OH_LOG_IsLevelEnabled} is true for the level. \n
+ *
  * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
  * @param fmt Indicates the format string, which is an enhancement of a printf format string and supports the privacy
  * identifier. Specifically, {public} or {private} is added between the % character and the format specifier in
@@ -285,7 +331,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_INFO(type, ...) ((void)OH_LOG_Print((type), LOG_INFO, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_INFO(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_INFO) && \
+    HILOG_PRINT((type), LOG_INFO, __VA_ARGS__)))
 
 /**
  * @brief Outputs warning logs. This is a function-like macro.
@@ -293,6 +340,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * Before calling this function, define the log service domain and log tag. Generally, you need to define them
  * at the beginning of the source file. \n
  *
+ * The parameters are evaluated only if {@link OH_LOG_IsLevelEnabled} is true for the level. \n
+ *
  * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
  * @param fmt Indicates the format string, which is an enhancement of a printf format string and supports the
  * privacy identifier. Specifically, {public} or {private} is added between the % character and the format specifier
@@ -302,7 +351,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_WARN(type, ...) ((void)OH_LOG_Print((type), LOG_WARN, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_WARN(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_WARN) && \
+    HILOG_PRINT((type), LOG_WARN, __VA_ARGS__)))
 
 /**
  * @brief Outputs error logs. This is a function-like macro.
@@ -310,6 +360,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * Before calling this function, define the log service domain and log tag. Generally, you need to define
  * them at the beginning of the source file. \n
  *
+ * The parameters are evaluated only if {@link OH_LOG_IsLevelEnabled} is true for the level. \n
+ *
  * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
  * @param fmt Indicates the format string, which is an enhancement of a printf format string and supports the privacy
  * identifier. Specifically, {public} or {private} is added between the % character and the format specifier in each
@@ -319,7 +371,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_ERROR(type, ...) ((void)OH_LOG_Print((type), LOG_ERROR, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_ERROR(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_ERROR) && \
+    HILOG_PRINT((type), LOG_ERROR, __VA_ARGS__)))
 
 /**
  * @brief Outputs fatal logs. This is a function-like macro.
@@ -327,6 +380,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * Before calling this function, define the log service domain and log tag. Generally, you need to define them at
  * the beginning of the source file. \n
  *
+ * The parameters are evaluated only if {@link OH_LOG_IsLevelEnabled} is true for the level. \n
+ *
  * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
  * @param fmt Indicates the format string, which is an enhancement of a printf format string and supports the privacy
  * identifier. Specifically, {public} or {private} is added between the % character and the format specifier in
@@ -336,7 +391,8 @@ bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_FATAL(type, ...) ((void)OH_LOG_Print((type), LOG_FATAL, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_FATAL(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_FATAL) && \
+    HILOG_PRINT((type), LOG_FATAL, __VA_ARGS__)))
 
 /**
  * @brief Defines the function pointer type for the user-defined log processing function.
@@ -383,9 +439,282 @@ void OH_LOG_SetMinLogLevel(LogLevel level);
  */
 void OH_LOG_SetLogLevel(LogLevel level, PreferStrategy prefer);
 
+/**
+ * @brief Defines the statistics of the deferred log mode, obtained through {@link OH_LOG_GetDeferredStats}.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** Number of log records stored into the per-thread ring buffers. */
+    unsigned long long recorded;
+    /** Number of log records formatted and output by the background drainer. */
+    unsigned long long flushed;
+    /** Number of log records dropped because the ring buffer of the calling thread was full. */
+    unsigned long long dropped;
+    /** Number of batches output by the background drainer. */
+    unsigned long long batches;
+} LogDeferredStats;
+
+/**
+ * @brief Enables the deferred log mode of the current process.
+ *
+ * In the deferred mode, {@link OH_LOG_Print} and {@link OH_LOG_VPrint} do not format the log on the calling thread.
+ * Instead, the format string and the raw parameters are stored into a lock-free ring buffer owned by the calling
+ * thread, and a background drainer thread formats the records and outputs them in batches. The format string, the
+ * log tag and string parameters are copied into the record, so they can be freed or modified once the call returns.
+ * To avoid copying the format string and the log tag, register them once through {@link OH_LOG_RegisterFormat} and
+ * log through {@link OH_LOG_PrintById}, which records only the ID; the log macros do this for each call site when
+ * <b>HILOG_INTERN_FORMAT</b> is defined before this header is included, in which case the format string and
+ * <b>LOG_TAG</b> must be string literals. If the ring buffer of the calling thread is full, the record is dropped and
+ * counted in {@link LogDeferredStats}. \n
+ * Logs of the <b>LOG_FATAL</b> level, {@link OH_LOG_PrintMsg} and {@link OH_LOG_PrintMsgByLen} are always output
+ * synchronously, after the records of the calling thread are flushed. The callback set through
+ * {@link OH_LOG_SetCallback} keeps receiving all logs, in order per thread, and is invoked on the drainer thread for
+ * deferred records. \n
+ *
+ * @param bufferSize Indicates the size of the ring buffer of each thread, in bytes. The value is rounded up to a
+ * power of 2. The value <b>0</b> means the default size, 64 KB.
+ * @param flushIntervalMs Indicates the maximum time, in milliseconds, that a record stays in a ring buffer before it
+ * is output. The value <b>0</b> means the default interval, 100 ms.
+ * @return Returns <b>0</b> if the deferred mode is enabled or is already enabled; returns a value smaller than
+ * <b>0</b> otherwise.
+ * @see OH_LOG_DisableDeferredMode
+ * @since 26.1.0
+ */
+int OH_LOG_EnableDeferredMode(unsigned int bufferSize, unsigned int flushIntervalMs);
+
+/**
+ * @brief Disables the deferred log mode of the current process.
+ *
+ * All buffered records are output before this function returns, and subsequent logs are output synchronously.
+ *
+ * @since 26.1.0
+ */
+void OH_LOG_DisableDeferredMode(void);
+
+/**
+ * @brief Outputs all records buffered in the deferred log mode.
+ *
+ * This function returns after all records buffered before the call are output. It does nothing if the deferred
+ * mode is not enabled.
+ *
+ * @return Returns the number of records output; returns a value smaller than <b>0</b> if the operation fails.
+ * @since 26.1.0
+ */
+int OH_LOG_Flush(void);
+
+/**
+ * @brief Obtains the statistics of the deferred log mode since it was enabled.
+ *
+ * @param stats Indicates the pointer to the statistics to be filled in.
+ * @return Returns <b>0</b> if the operation is successful; returns a value smaller than <b>0</b> if
+ * <b>stats</b> is a null pointer or the deferred mode is not enabled.
+ * @since 26.1.0
+ */
+int OH_LOG_GetDeferredStats(LogDeferredStats *stats);
+
+/**
+ * @brief Registers a log tag and a format string for {@link OH_LOG_PrintById}.
+ *
+ * Only the addresses are stored, so the strings must stay valid and unchanged until the process exits, which is the
+ * case for string literals. Registering the same addresses again returns the same ID, so concurrent first calls from
+ * one call site are harmless. \n
+ *
+ * @param tag Indicates the log tag, which is a string used to identify the class, file, or service behavior.
+ * @param fmt Indicates the format string, which is an enhancement of a printf format string and supports the privacy
+ * identifier.
+ * @return Returns the ID of the format, which is greater than <b>0</b>, if the operation is successful; returns a
+ * value smaller than <b>0</b> if <b>tag</b> or <b>fmt</b> is a null pointer or the registry is full.
+ * @see OH_LOG_PrintById
+ * @since 26.1.0
+ */
+int OH_LOG_RegisterFormat(const char *tag, const char *fmt);
+
+/**
+ * @brief Outputs logs with a format registered through {@link OH_LOG_RegisterFormat}.
+ *
+ * It behaves like {@link OH_LOG_Print} with the registered log tag and format string. In the deferred log mode, only
+ * the ID and the parameters are stored into the record. \n
+ *
+ * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
+ * @param level Indicates the log level, which can be <b>LOG_DEBUG</b>, <b>LOG_INFO</b>, <b>LOG_WARN</b>,
+ * <b>LOG_ERROR</b>, and <b>LOG_FATAL</b>.
+ * @param domain Indicates the service domain of logs. Its value is a hexadecimal integer ranging from 0x0 to 0xFFFF.
+ * @param formatId Indicates the ID returned by {@link OH_LOG_RegisterFormat}.
+ * @param ... Indicates a list of parameters. The number and type of parameters must map onto the format specifiers
+ * in the registered format string.
+ * @return Returns <b>0</b> or a larger value if the operation is successful; returns a value smaller
+ * than <b>0</b> if <b>formatId</b> is not registered or the operation fails.
+ * @since 26.1.0
+ */
+int OH_LOG_PrintById(LogType type, LogLevel level, unsigned int domain, int formatId, ...);
+
 #ifdef __cplusplus
 }
 #endif
+
+#if defined(__cplusplus) && (__cplusplus >= 201402L)
+/**
+ * @brief Obtains the length of the privacy identifier at the start of a string.
+ *
+ * @param p Indicates the string to check.
+ * @return Returns the length of <b>{public}</b> or <b>{private}</b> if the string starts with it; returns <b>0</b>
+ * otherwise.
+ * @since 26.1.0
+ */
+constexpr int OH_LOG_PrivacyTagLength(const char *p)
+{
+    const char *tags[] = { "{public}", "{private}" };
+    for (const char *tag : tags) {
+        int len = 0;
+        while (tag[len] != '\0' && p[len] == tag[len]) {
+            ++len;
+        }
+        if (tag[len] == '\0') {
+            return len;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Checks a HiLog format string at compile time.
+ *
+ * A format string is valid if each conversion specification has the form
+ * <b>%[{public}|{private}][flags][width][.precision][length]conversion</b>, <b>%%</b> is used for a literal percent
+ * sign, and <b>%n</b> is not used. The privacy identifier must be placed directly after the % character, and it must
+ * not appear anywhere else in the format string. \n
+ *
+ * @param fmt Indicates the format string.
+ * @return Returns <b>true</b> if the format string is valid; returns <b>false</b> otherwise.
+ * @since 26.1.0
+ */
+constexpr bool OH_LOG_CheckFormat(const char *fmt)
+{
+    if (fmt == nullptr) {
+        return true;
+    }
+    for (const char *p = fmt; *p != '\0'; ++p) {
+        if (*p != '%') {
+            if (OH_LOG_PrivacyTagLength(p) != 0) {
+                return false;
+            }
+            continue;
+        }
+        ++p;
+        if (*p == '%') {
+            continue;
+        }
+        if (*p == '{') {
+            int len = OH_LOG_PrivacyTagLength(p);
+            if (len == 0) {
+                return false;
+            }
+            p += len;
+        }
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+            ++p;
+        }
+        while ((*p >= '0' && *p <= '9') || *p == '*') {
+            ++p;
+        }
+        if (*p == '.') {
+            ++p;
+            while ((*p >= '0' && *p <= '9') || *p == '*') {
+                ++p;
+            }
+        }
+        while (*p == 'h' || *p == 'l' || *p == 'L' || *p == 'j' || *p == 'z' || *p == 't' || *p == 'q') {
+            ++p;
+        }
+        bool known = false;
+        for (const char *c = "diouxXeEfFgGaAcsp"; *c != '\0'; ++c) {
+            known = known || (*p == *c);
+        }
+        if (!known) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reports an invalid HiLog format string at compile time.
+ *
+ * The log macros instantiate it with the result of {@link OH_LOG_CheckFormat} on their format string when
+ * <b>HILOG_CHECK_FORMAT</b> is defined before this header is included. The format string must then be a string
+ * literal. It is available only in C++14 or later; in C and in earlier C++ versions, <b>HILOG_CHECK_FORMAT</b> has no
+ * effect. \n
+ *
+ * @since 26.1.0
+ */
+template <bool valid>
+struct OH_LOG_FormatCheck {
+    static_assert(valid, "invalid hilog format string, see OH_LOG_CheckFormat");
+    static constexpr int value = 0;
+};
+
+#ifdef HILOG_CHECK_FORMAT
+/**
+ * @brief Expands to the first argument of a log macro, which is the format string. This is a helper macro of
+ * {@link HILOG_FORMAT_CHECK}.
+ *
+ * @since 26.1.0
+ */
+#define HILOG_FIRST_ARG(fmt, ...) (fmt)
+
+/**
+ * @brief Checks the format string of a log macro at compile time through {@link OH_LOG_FormatCheck}. This is a helper
+ * macro of the log macros.
+ *
+ * @since 26.1.0
+ */
+#define HILOG_FORMAT_CHECK(...) (void)OH_LOG_FormatCheck<OH_LOG_CheckFormat(HILOG_FIRST_ARG(__VA_ARGS__, 0))>::value,
+#endif
+#endif
+
+#ifndef HILOG_FORMAT_CHECK
+/**
+ * @brief Expands to nothing when the format string of the log macros is not checked at compile time. This is a
+ * helper macro of the log macros.
+ *
+ * <b>HILOG_CHECK_FORMAT</b> takes effect only in C++14 or later, because {@link OH_LOG_CheckFormat} requires a
+ * C++14 constexpr function. In C and in earlier C++ versions, defining it has no effect. \n
+ *
+ * @since 26.1.0
+ */
+#define HILOG_FORMAT_CHECK(...)
+#endif
+
+#if defined(HILOG_INTERN_FORMAT) && defined(__GNUC__)
+/**
+ * @brief Outputs a log for a log macro through a format ID registered once per call site. This is a helper macro of
+ * the log macros.
+ *
+ * It is used when <b>HILOG_INTERN_FORMAT</b> is defined before this header is included. The format string and
+ * <b>LOG_TAG</b> must be string literals. If the registration fails, the log is output through {@link OH_LOG_Print}.
+ * \n
+ *
+ * @since 26.1.0
+ */
+#define HILOG_PRINT(type, level, fmt, ...) __extension__({ \
+    static int hilogFormatId = 0; \
+    int hilogId = __atomic_load_n(&hilogFormatId, __ATOMIC_RELAXED); \
+    if (hilogId == 0) { \
+        hilogId = OH_LOG_RegisterFormat("" LOG_TAG "", "" fmt ""); \
+        __atomic_store_n(&hilogFormatId, hilogId, __ATOMIC_RELAXED); \
+    } \
+    hilogId > 0 ? OH_LOG_PrintById((type), (level), LOG_DOMAIN, hilogId, ##__VA_ARGS__) : \
+        OH_LOG_Print((type), (level), LOG_DOMAIN, LOG_TAG, fmt, ##__VA_ARGS__); \
+})
+#else
+/**
+ * @brief Outputs a log for a log macro through {@link OH_LOG_Print}. This is a helper macro of the log macros.
+ *
+ * @since 26.1.0
+ */
+#define HILOG_PRINT(type, level, ...) OH_LOG_Print((type), (level), LOG_DOMAIN, LOG_TAG, __VA_ARGS__)
+#endif
 /** @} */
 
 #ifdef HILOG_RAWFORMAT
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -51,6 +51,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -773,6 +774,280 @@ int32_t OH_HiTrace_RegisterTraceListener(OH_HiTrace_TraceEventListener callback)
  */
 int32_t OH_HiTrace_UnregisterTraceListener(int32_t index);
 
+/**
+ * @brief Defines a trace category, which groups trace points that are enabled and sampled together.
+ * A category is obtained through {@link OH_HiTrace_RegisterCategory} and stays valid until the process exits.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiTrace_Category {
+    /**
+     * Whether the trace points of the category are recorded. The value is maintained by HiTrace and changes when
+     * the application trace capture starts or stops. Read it only through {@link OH_HiTrace_IsCategoryEnabled}.
+     * @since 26.1.0
+     */
+    uint32_t enabled;
+    /**
+     * Reserved field.
+     * @since 26.1.0
+     */
+    uint32_t reserved;
+} HiTrace_Category;
+
+/**
+ * @brief Defines a span opened by {@link OH_HiTrace_SpanBegin} and closed by {@link OH_HiTrace_SpanEnd}.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiTrace_Span {
+    /**
+     * ID of the trace point of the span.
+     * @since 26.1.0
+     */
+    uint32_t tracePointId;
+    /**
+     * Begin token of the span. The value **0** indicates that the span is not recorded.
+     * @since 26.1.0
+     */
+    uint64_t token;
+} HiTrace_Span;
+
+/**
+ * @brief Registers a trace category.
+ * Registering the same name again returns the same category.
+ *
+ * @param name Name of the category. The name is copied.
+ * @param level Trace output level of the trace points of the category.
+ * @return Pointer to the category, which stays valid until the process exits; **NULL** if **name** is **NULL** or
+ *     memory allocation fails.
+ * @since 26.1.0
+ */
+const HiTrace_Category *OH_HiTrace_RegisterCategory(const char *name, HiTrace_Output_Level level);
+
+/**
+ * @brief Sets the sampling interval of a trace category.
+ * When sampling is set, only one of every **interval** spans of the category is recorded on each thread, and spans
+ * nested in a span that is not recorded are not recorded either.
+ *
+ * @param category Trace category obtained through {@link OH_HiTrace_RegisterCategory}.
+ * @param interval Sampling interval. The value **0** or **1** indicates that every span is recorded.
+ * @return Result code.
+ *     **0**: The operation is successful.
+ *     **-1**: **category** is invalid.
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_SetCategorySampling(const HiTrace_Category *category, uint32_t interval);
+
+/**
+ * @brief Registers a trace point of a trace category.
+ * The name is interned once, so that recording a span of the trace point passes only its ID.
+ * Registering the same name in the same category again returns the same ID.
+ *
+ * @param category Trace category obtained through {@link OH_HiTrace_RegisterCategory}.
+ * @param name Name of the trace point. The name is copied.
+ * @return ID of the trace point; **0** if a parameter is invalid or memory allocation fails.
+ * @since 26.1.0
+ */
+uint32_t OH_HiTrace_RegisterTracePoint(const HiTrace_Category *category, const char *name);
+
+/**
+ * @brief Records the beginning of a span of a trace point.
+ * Use {@link OH_HiTrace_SpanBegin} instead of calling this API directly, so that nothing is called when the
+ * category is disabled.
+ *
+ * @param tracePointId ID of the trace point obtained through {@link OH_HiTrace_RegisterTracePoint}.
+ * @return Token to be passed to {@link OH_HiTrace_EndTracePoint}; **0** if the span is not recorded because of
+ *     sampling, the trace capture is stopped, or **tracePointId** is invalid.
+ * @since 26.1.0
+ */
+uint64_t OH_HiTrace_BeginTracePoint(uint32_t tracePointId);
+
+/**
+ * @brief Records the end of a span of a trace point.
+ * Spans must be ended on the thread where they begin, in reverse order of beginning.
+ *
+ * @param tracePointId ID of the trace point.
+ * @param token Nonzero token returned by {@link OH_HiTrace_BeginTracePoint}.
+ * @since 26.1.0
+ */
+void OH_HiTrace_EndTracePoint(uint32_t tracePointId, uint64_t token);
+
+/**
+ * @brief Obtains the timestamp used by trace points, in nanoseconds.
+ * The timestamp is read from the monotonic clock without a system call and is comparable with the timestamps in the
+ * captured trace.
+ *
+ * @return Timestamp, in nanoseconds.
+ * @since 26.1.0
+ */
+uint64_t OH_HiTrace_GetTimestamp(void);
+
+/**
+ * @brief Checks whether the trace points of a category are recorded. This is a function-like macro.
+ * The check reads one field of the category without a function call.
+ *
+ * @param category Trace category obtained through {@link OH_HiTrace_RegisterCategory}.
+ * @return **true** if the category is enabled; **false** otherwise.
+ * @since 26.1.0
+ */
+#define OH_HiTrace_IsCategoryEnabled(category) (__atomic_load_n(&(category)->enabled, __ATOMIC_RELAXED) != 0)
+
+/**
+ * @brief Begins a span of a trace point.
+ * When the category is disabled, this function only checks {@link OH_HiTrace_IsCategoryEnabled} and returns a span
+ * that is not recorded.
+ *
+ * @param category Trace category of the trace point. If it is NULL, for example because
+ *     {@link OH_HiTrace_RegisterCategory} failed, the span is not recorded.
+ * @param tracePointId ID of the trace point obtained through {@link OH_HiTrace_RegisterTracePoint}.
+ * @return Span to be passed to {@link OH_HiTrace_SpanEnd}.
+ * @since 26.1.0
+ */
+static inline HiTrace_Span OH_HiTrace_SpanBegin(const HiTrace_Category *category, uint32_t tracePointId)
+{
+    HiTrace_Span span = { tracePointId, 0 };
+    if (__builtin_expect(category != NULL && OH_HiTrace_IsCategoryEnabled(category), 0)) {
+        span.token = OH_HiTrace_BeginTracePoint(tracePointId);
+    }
+    return span;
+}
+
+/**
+ * @brief Ends a span begun by {@link OH_HiTrace_SpanBegin}.
+ * Nothing is called if the span is not recorded.
+ *
+ * @param span Pointer to the span.
+ * @since 26.1.0
+ */
+static inline void OH_HiTrace_SpanEnd(HiTrace_Span *span)
+{
+    if (__builtin_expect(span->token != 0, 0)) {
+        OH_HiTrace_EndTracePoint(span->tracePointId, span->token);
+        span->token = 0;
+    }
+}
+
+#define HITRACE_SPAN_VAR_CONCAT(name, line) name##line
+#define HITRACE_SPAN_VAR(line) HITRACE_SPAN_VAR_CONCAT(hitraceScopedSpan, line)
+
+/**
+ * @brief Records a span of a trace point from this statement to the end of the enclosing scope. This is a
+ * function-like macro.
+ * The span is ended automatically when the scope exits.
+ *
+ * @param category Trace category of the trace point.
+ * @param tracePointId ID of the trace point obtained through {@link OH_HiTrace_RegisterTracePoint}.
+ * @since 26.1.0
+ */
+#define OH_HiTrace_ScopedSpan(category, tracePointId) \
+    HiTrace_Span HITRACE_SPAN_VAR(__LINE__) __attribute__((cleanup(OH_HiTrace_SpanEnd))) = \
+        OH_HiTrace_SpanBegin((category), (tracePointId))
+
+/**
+ * @brief Defines an in-process trace session, which records the traces of the current process into local buffers
+ * without the trace capture service.
+ *
+ * @since 26.1.0
+ */
+typedef struct HiTrace_Session HiTrace_Session;
+
+/**
+ * @brief Enumerates the formats in which an in-process trace session can be exported.
+ *
+ * @since 26.1.0
+ */
+typedef enum HiTrace_ExportFormat {
+    /**
+     * @brief Perfetto protobuf trace format.
+     *
+     * @since 26.1.0
+     */
+    HITRACE_EXPORT_FORMAT_PERFETTO = 0,
+
+    /**
+     * @brief Chrome JSON trace event format.
+     *
+     * @since 26.1.0
+     */
+    HITRACE_EXPORT_FORMAT_CHROME_JSON = 1
+} HiTrace_ExportFormat;
+
+/**
+ * @brief Creates an in-process trace session.
+ * While the session is running, synchronous traces, asynchronous traces, integer variable traces and trace point
+ * spans of the current process whose output level is not lower than **level** are recorded into a ring buffer of
+ * the thread that emits them, in addition to the application trace capture. When a ring buffer is full, the oldest
+ * records of the thread are overwritten. Only one session can exist in a process at a time.
+ *
+ * @param bufferSize Size of the ring buffer of each thread, in bytes. The value **0** indicates the default size,
+ *     256 KB.
+ * @param level Lowest trace output level to record.
+ * @return Pointer to the session; **NULL** if a session already exists or memory allocation fails.
+ * @since 26.1.0
+ */
+HiTrace_Session *OH_HiTrace_CreateSession(uint32_t bufferSize, HiTrace_Output_Level level);
+
+/**
+ * @brief Starts recording an in-process trace session.
+ * The categories registered through {@link OH_HiTrace_RegisterCategory} are enabled while the session is running.
+ *
+ * @param session Session created through {@link OH_HiTrace_CreateSession}.
+ * @return Result code.
+ *     **0**: The operation is successful.
+ *     **-1**: **session** is invalid.
+ *     **-2**: The session is already running.
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_StartSession(HiTrace_Session *session);
+
+/**
+ * @brief Stops recording an in-process trace session.
+ * The recorded data is kept until the session is destroyed or started again.
+ *
+ * @param session Session created through {@link OH_HiTrace_CreateSession}.
+ * @return Result code.
+ *     **0**: The operation is successful.
+ *     **-1**: **session** is invalid.
+ *     **-2**: The session is not running.
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_StopSession(HiTrace_Session *session);
+
+/**
+ * @brief Exports the data recorded by a stopped in-process trace session to a file.
+ * Async traces are exported as async slices, integer variable traces as counters, and synchronous traces and trace
+ * point spans as slices of the thread that emits them.
+ *
+ * @param session Session created through {@link OH_HiTrace_CreateSession}.
+ * @param format Export format.
+ * @param path Path of the file to write. An existing file is overwritten.
+ * @return Result code.
+ *     **0**: The operation is successful.
+ *     **-1**: A parameter is invalid.
+ *     **-2**: The session is running.
+ *     **-3**: The file fails to be written.
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_ExportSession(HiTrace_Session *session, HiTrace_ExportFormat format, const char *path);
+
+/**
+ * @brief Obtains the number of records overwritten in the ring buffers of an in-process trace session since it
+ * was last started.
+ *
+ * @param session Session created through {@link OH_HiTrace_CreateSession}.
+ * @return Number of overwritten records; **0** if **session** is invalid.
+ * @since 26.1.0
+ */
+uint64_t OH_HiTrace_GetSessionOverwrittenCount(const HiTrace_Session *session);
+
+/**
+ * @brief Destroys an in-process trace session. A running session is stopped first.
+ *
+ * @param session Session created through {@link OH_HiTrace_CreateSession}.
+ * @since 26.1.0
+ */
+void OH_HiTrace_DestroySession(HiTrace_Session *session);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -43,6 +43,7 @@
 #ifndef FFRT_API_C_FIBER_H
 #define FFRT_API_C_FIBER_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "type_def.h"
 
@@ -80,5 +81,123 @@ FFRT_C_API int ffrt_fiber_init(ffrt_fiber_t* fiber, void(*func)(void*), void* ar
  */
 FFRT_C_API void ffrt_fiber_switch(ffrt_fiber_t* from, ffrt_fiber_t* to);
 
+/**
+ * @brief Fiber pool handle, which identifies different fiber pools.
+ *
+ * A fiber pool owns a set of fiber stacks of the same size and recycles them between fibers,
+ * so that creating a fiber does not require a new memory mapping.
+ *
+ * @since 26.1.0
+ */
+typedef void* ffrt_fiber_pool_t;
+
+/**
+ * @brief Creates a fiber pool.
+ *
+ * Stacks are carved from large shared mappings and are reused after the fiber that owns
+ * them is released. When `guard_page` is `true`, each stack is preceded by an inaccessible
+ * guard page so that a stack overflow faults instead of corrupting adjacent stacks.
+ *
+ * @param stack_size Indicates the size of each fiber stack, in bytes. The value is rounded up
+ *                   to a multiple of the page size and must be large enough to hold the fiber context.
+ * @param capacity Indicates the maximum number of fibers that can be acquired from the pool at the
+ *                 same time. `0` means no limit.
+ * @param guard_page Indicates whether to place a guard page below each stack.
+ * @return A non-null fiber pool handle if the pool is created;
+ *         a null pointer otherwise.
+ * @see ffrt_fiber_pool_destroy
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_fiber_pool_t ffrt_fiber_pool_create(size_t stack_size, uint32_t capacity, bool guard_page);
+
+/**
+ * @brief Destroys a fiber pool.
+ *
+ * All fibers acquired from the pool must have been released, and {@link ffrt_fiber_pool_run}
+ * must not be running on the pool; otherwise the behavior is undefined.
+ *
+ * @param pool Indicates a fiber pool handle.
+ * @return `ffrt_success` if the pool is destroyed;
+ *         `ffrt_error_inval` if `pool` is null;
+ *         `ffrt_error_busy` if fibers acquired from the pool have not been released.
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_fiber_pool_destroy(ffrt_fiber_pool_t pool);
+
+/**
+ * @brief Acquires a fiber from a fiber pool.
+ *
+ * The returned fiber is initialized as by {@link ffrt_fiber_init} on a stack owned by the pool,
+ * and can be run with {@link ffrt_fiber_switch}. The fiber must be returned with
+ * {@link ffrt_fiber_pool_release} after its entry point function no longer runs.
+ *
+ * @param pool Indicates a fiber pool handle.
+ * @param func Indicates the entry point function that the fiber will execute.
+ * @param arg Indicates the argument to be passed to the entry point function.
+ * @return A non-null pointer to the fiber if a fiber is acquired;
+ *         a null pointer if `pool` or `func` is null, the pool capacity is reached, or memory allocation fails.
+ * @see ffrt_fiber_pool_release
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_fiber_t* ffrt_fiber_pool_acquire(ffrt_fiber_pool_t pool, void(*func)(void*), void* arg);
+
+/**
+ * @brief Releases a fiber back to its fiber pool.
+ *
+ * The fiber stack is kept by the pool for reuse. The fiber must not be running and must not
+ * be used again after release.
+ *
+ * @param pool Indicates a fiber pool handle.
+ * @param fiber Indicates a fiber acquired from `pool` with {@link ffrt_fiber_pool_acquire}.
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_fiber_pool_release(ffrt_fiber_pool_t pool, ffrt_fiber_t* fiber);
+
+/**
+ * @brief Spawns a fiber on the scheduler of a fiber pool.
+ *
+ * A fiber is acquired from the pool and appended to the run queue of the pool. It starts
+ * running on the next {@link ffrt_fiber_pool_run} call on the pool, and is released to the
+ * pool automatically when its entry point function returns.
+ *
+ * @param pool Indicates a fiber pool handle.
+ * @param func Indicates the entry point function that the fiber will execute.
+ * @param arg Indicates the argument to be passed to the entry point function.
+ * @return `ffrt_success` if the fiber is spawned;
+ *         `ffrt_error_inval` if `pool` or `func` is null;
+ *         `ffrt_error_nomem` if the pool capacity is reached or memory allocation fails.
+ * @see ffrt_fiber_pool_run
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_fiber_pool_spawn(ffrt_fiber_pool_t pool, void(*func)(void*), void* arg);
+
+/**
+ * @brief Runs the fibers spawned on a fiber pool.
+ *
+ * This function occupies the calling thread, running the spawned fibers in first-in-first-out
+ * order until the run queue is empty. A running fiber gives up the calling thread by calling
+ * {@link ffrt_fiber_pool_yield} or by returning from its entry point function. Fibers spawned
+ * while the pool is running are run in the same call.
+ *
+ * @param pool Indicates a fiber pool handle.
+ * @return `ffrt_success` if all spawned fibers have finished;
+ *         `ffrt_error_inval` if `pool` is null;
+ *         `ffrt_error_busy` if the pool is already running on another thread.
+ * @see ffrt_fiber_pool_spawn
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_fiber_pool_run(ffrt_fiber_pool_t pool);
+
+/**
+ * @brief Yields the current fiber to the scheduler of its fiber pool.
+ *
+ * The calling fiber is appended to the tail of the run queue, and the next fiber in the run
+ * queue is resumed. This function must be called from a fiber spawned with
+ * {@link ffrt_fiber_pool_spawn}; otherwise it returns immediately.
+ *
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_fiber_pool_yield(void);
+
 #endif // FFRT_API_C_FIBER_H
 /** @} */
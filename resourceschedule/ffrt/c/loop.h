@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -41,6 +41,8 @@
 #define FFRT_API_C_LOOP_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <sys/socket.h>
 #include "type_def.h"
 #include "queue.h"
 
@@ -147,5 +149,168 @@ FFRT_C_API ffrt_timer_t ffrt_loop_timer_start(
  */
 FFRT_C_API int ffrt_loop_timer_stop(ffrt_loop_t loop, ffrt_timer_t handle);
 
+/**
+ * @brief Sets up completion-based I/O on ffrt loop.
+ *
+ * Must be called before any `ffrt_loop_io_*` request is submitted to the loop. With
+ * {@link ffrt_io_backend_auto}, io_uring is used when the kernel supports it, and the loop
+ * falls back to epoll otherwise; use {@link ffrt_loop_io_get_backend} to query the result.
+ *
+ * @param loop Indicates a loop handle.
+ * @param entries Indicates the maximum number of in-flight I/O requests. The value range is (0, 32768].
+ * @param backend Indicates the preferred I/O backend.
+ * @return `ffrt_success` if the I/O context is set up;
+ *         `ffrt_error_inval` if `loop` is null or `entries` is out of range;
+ *         `ffrt_error_nomem` if the I/O context fails to be allocated;
+ *         `ffrt_error_busy` if the I/O context has already been set up.
+ * @see ffrt_loop_io_get_backend
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_setup(ffrt_loop_t loop, uint32_t entries, ffrt_io_backend_t backend);
+
+/**
+ * @brief Gets the I/O backend in use on ffrt loop.
+ *
+ * @param loop Indicates a loop handle.
+ * @return The I/O backend selected by {@link ffrt_loop_io_setup};
+ *         `ffrt_io_backend_auto` if `loop` is null or the I/O context has not been set up.
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_backend_t ffrt_loop_io_get_backend(ffrt_loop_t loop);
+
+/**
+ * @brief Submits an asynchronous read request on ffrt loop.
+ *
+ * The request is queued and sent to the kernel together with other queued requests on the
+ * next {@link ffrt_loop_io_submit} call or loop iteration. `buf` must stay valid until the
+ * request completes.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the file descriptor to read from.
+ * @param buf Indicates the destination buffer.
+ * @param len Indicates the number of bytes to read.
+ * @param offset Indicates the file offset to read from, or `-1` to use the current file position.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed when the request completes. May be null if the
+ *           result is obtained with {@link ffrt_loop_io_wait}.
+ * @return A non-null I/O request handle if the request is queued;
+ *         a null pointer otherwise.
+ * @see ffrt_loop_io_wait
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_read(
+    ffrt_loop_t loop, int fd, void* buf, size_t len, int64_t offset, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief Submits an asynchronous write request on ffrt loop.
+ *
+ * `buf` must stay valid until the request completes.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the file descriptor to write to.
+ * @param buf Indicates the source buffer.
+ * @param len Indicates the number of bytes to write.
+ * @param offset Indicates the file offset to write to, or `-1` to use the current file position.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed when the request completes. May be null if the
+ *           result is obtained with {@link ffrt_loop_io_wait}.
+ * @return A non-null I/O request handle if the request is queued;
+ *         a null pointer otherwise.
+ * @see ffrt_loop_io_wait
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_write(
+    ffrt_loop_t loop, int fd, const void* buf, size_t len, int64_t offset, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief Submits an asynchronous fsync request on ffrt loop.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the file descriptor to synchronize.
+ * @param datasync Indicates whether to synchronize only file data, as `fdatasync` does.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed when the request completes. May be null if the
+ *           result is obtained with {@link ffrt_loop_io_wait}.
+ * @return A non-null I/O request handle if the request is queued;
+ *         a null pointer otherwise.
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_fsync(ffrt_loop_t loop, int fd, bool datasync, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief Submits an asynchronous accept request on ffrt loop.
+ *
+ * `addr` and `addrlen` must stay valid until the request completes. On completion, the result
+ * passed to cb is the accepted file descriptor.
+ *
+ * @param loop Indicates a loop handle.
+ * @param fd Indicates the listening socket.
+ * @param addr Indicates the buffer that receives the peer address. May be null.
+ * @param addrlen Indicates the size of `addr` on input and the actual address length on output.
+ *                Must be null if `addr` is null.
+ * @param data Indicates user data used in cb.
+ * @param cb Indicates user cb which will be executed when the request completes. May be null if the
+ *           result is obtained with {@link ffrt_loop_io_wait}.
+ * @return A non-null I/O request handle if the request is queued;
+ *         a null pointer otherwise.
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_accept(
+    ffrt_loop_t loop, int fd, struct sockaddr* addr, socklen_t* addrlen, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief Submits all queued I/O requests on ffrt loop.
+ *
+ * Queued requests are otherwise submitted at the next loop iteration. With the io_uring
+ * backend, all queued requests are submitted with a single system call.
+ *
+ * @param loop Indicates a loop handle.
+ * @return The number of requests submitted;
+ *         `-1` if `loop` is null or the I/O context has not been set up.
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_submit(ffrt_loop_t loop);
+
+/**
+ * @brief Waits until an I/O request completes.
+ *
+ * When called from an FFRT task, the task is suspended and the worker thread is released
+ * to run other tasks until the request completes. When called from a non-FFRT thread, the
+ * calling thread is blocked. Queued requests are submitted before waiting.
+ *
+ * @param handle Indicates the I/O request handle.
+ * @param result Indicates the pointer that receives the result of the operation, as described in
+ *               {@link ffrt_io_cb}. May be null.
+ * @return `ffrt_success` if the request has completed;
+ *         `ffrt_error_inval` if `handle` is null.
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_wait(ffrt_io_handle_t handle, int64_t* result);
+
+/**
+ * @brief Cancels an I/O request on ffrt loop.
+ *
+ * If the request has not completed yet, it completes with `-ECANCELED`.
+ *
+ * @param loop Indicates a loop handle.
+ * @param handle Indicates the I/O request handle.
+ * @return `ffrt_success` if the cancellation is requested;
+ *         `ffrt_error_inval` if `loop` or `handle` is null;
+ *         `ffrt_error_busy` if the request is already being completed.
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_cancel(ffrt_loop_t loop, ffrt_io_handle_t handle);
+
+/**
+ * @brief Destroys an I/O request handle.
+ *
+ * If the request is still in flight, the handle is released after the request completes.
+ * The handle must not be used again after destruction.
+ *
+ * @param handle Indicates the I/O request handle.
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_loop_io_handle_destroy(ffrt_io_handle_t handle);
+
 #endif // FFRT_API_C_LOOP_H
 /** @} */
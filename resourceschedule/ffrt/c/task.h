@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -172,6 +172,58 @@ FFRT_C_API void ffrt_task_attr_set_stack_size(ffrt_task_attr_t* attr, uint64_t s
  */
 FFRT_C_API uint64_t ffrt_task_attr_get_stack_size(const ffrt_task_attr_t* attr);
 
+/**
+ * @brief Sets the deadline of a task attribute.
+ *
+ * Among ready tasks of the same QoS, tasks with a deadline are dispatched in
+ * earliest-deadline-first order, ahead of tasks without a deadline. The deadline does not
+ * change the QoS of the task and does not preempt a running task. A task that finishes
+ * after its deadline is reported through the callback registered with
+ * {@link ffrt_register_deadline_miss_callback}.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param deadline_us Indicates the deadline, in microseconds, relative to the time the task is submitted.
+ *                    If a delay is set with {@link ffrt_task_attr_set_delay}, the deadline is relative to
+ *                    the time the delay elapses. `0` means no deadline, which is the default.
+ * @see ffrt_task_attr_get_deadline
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_task_attr_set_deadline(ffrt_task_attr_t* attr, uint64_t deadline_us);
+
+/**
+ * @brief Gets the deadline of a task attribute.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return The deadline, in microseconds; `0` if no deadline is set.
+ * @since 26.1.0
+ */
+FFRT_C_API uint64_t ffrt_task_attr_get_deadline(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Registers the callback used to report missed task deadlines.
+ *
+ * Only one callback is kept per process; registering a new callback replaces the previous one.
+ *
+ * @param cb Indicates the deadline miss callback. A null pointer unregisters the callback.
+ * @param data Indicates user data used in cb.
+ * @return `ffrt_success` if the callback is registered or unregistered;
+ *         `ffrt_error` otherwise.
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_register_deadline_miss_callback(ffrt_deadline_miss_cb cb, void* data);
+
+/**
+ * @brief Gets the number of missed task deadlines of a QoS level.
+ *
+ * The count accumulates from process start and covers all tasks with a deadline whose QoS
+ * equals `qos`, whether or not a deadline miss callback is registered.
+ *
+ * @param qos Indicates the QoS level. The available levels are defined by {@link ffrt_qos_t}.
+ * @return The number of missed deadlines; `0` if `qos` is invalid.
+ * @since 26.1.0
+ */
+FFRT_C_API uint64_t ffrt_get_deadline_miss_count(ffrt_qos_t qos);
+
 /**
  * @brief Updates the QoS of this task.
  *
@@ -436,6 +436,54 @@ typedef void (*ffrt_timer_cb)(void* data);
  */
 typedef int ffrt_timer_t;
 
+/**
+ * @brief Enumerates the I/O backends used by the completion-based I/O interfaces of an ffrt loop.
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** Selects io_uring when the kernel supports it, and falls back to epoll otherwise. */
+    ffrt_io_backend_auto = 0,
+    /** Completion-based backend built on io_uring. Requests are submitted to the kernel in batches. */
+    ffrt_io_backend_uring,
+    /** Readiness-based fallback built on epoll. The operation is performed once the fd becomes ready. */
+    ffrt_io_backend_epoll,
+} ffrt_io_backend_t;
+
+/**
+ * @brief Defines the I/O completion callback function type.
+ *
+ * The callback is invoked on the loop thread when an I/O request submitted to an ffrt loop
+ * completes. The data pointer carries user data passed in at submission time.
+ *
+ * @param data Indicates the user data pointer passed in at I/O submission.
+ * @param result Indicates the result of the operation: the number of bytes transferred for
+ *               read and write, `0` for fsync, the accepted file descriptor for accept, or a
+ *               negative errno value if the operation fails.
+ * @since 26.1.0
+ */
+typedef void (*ffrt_io_cb)(void* data, int64_t result);
+
+/**
+ * @brief Defines the I/O request handle used to identify a submitted I/O request.
+ *
+ * @since 26.1.0
+ */
+typedef void* ffrt_io_handle_t;
+
+/**
+ * @brief Defines the deadline miss callback function type.
+ *
+ * The callback is invoked on a worker thread after a task with a deadline set through
+ * {@link ffrt_task_attr_set_deadline} finishes later than its deadline.
+ *
+ * @param data Indicates the user data pointer passed in at callback registration.
+ * @param task_id Indicates the ID of the task that missed its deadline.
+ * @param lateness_us Indicates how late the task finished relative to its deadline, in microseconds.
+ * @since 26.1.0
+ */
+typedef void (*ffrt_deadline_miss_cb)(void* data, uint64_t task_id, uint64_t lateness_us);
+
 #ifdef __cplusplus
 namespace ffrt {
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -444,6 +444,160 @@ OH_QoS_GewuErrorCode OH_QoS_GewuAbortRequest(OH_QoS_GewuSession session, OH_QoS_
  */
 OH_QoS_GewuSubmitRequestResult OH_QoS_GewuSubmitRequest(OH_QoS_GewuSession session,
     const char* request, OH_QoS_GewuOnResponse callback, void* context);
+
+/**
+ * @brief Thread group handle. A thread group is a set of threads that cooperate on a frame, such as render, audio
+ * and input threads, and are boosted by the system as a whole.
+ *
+ * @since 26.1.0
+ */
+typedef unsigned int OH_QoS_ThreadGroup;
+
+/**
+ * @brief Indicates an invalid thread group handle, which is written by **OH_QoS_CreateThreadGroup()** on failure.
+ *
+ * @since 26.1.0
+ */
+#define OH_QOS_INVALID_THREAD_GROUP_ID ((OH_QoS_ThreadGroup)(0xffffffffU))
+
+/**
+ * @brief CPU utilization of a thread group, obtained through **OH_QoS_GetThreadGroupStats()**.
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /**
+     * @brief Total CPU time consumed by all threads of the group in the statistics window, in microseconds.
+     *
+     * @since 26.1.0
+     */
+    unsigned long long cpuTimeUs;
+    /**
+     * @brief Length of the statistics window, in microseconds. The window starts when the group is created or when
+     * the statistics are last obtained, whichever is later.
+     *
+     * @since 26.1.0
+     */
+    unsigned long long windowUs;
+    /**
+     * @brief Number of frames marked by **OH_QoS_ThreadGroupFrameBegin()** in the statistics window.
+     *
+     * @since 26.1.0
+     */
+    unsigned int frames;
+    /**
+     * @brief Number of frames in the statistics window whose end was marked later than one frame period after
+     * their beginning.
+     *
+     * @since 26.1.0
+     */
+    unsigned int overrunFrames;
+} OH_QoS_ThreadGroupStats;
+
+/**
+ * @brief Creates a thread group. Threads added to the group share the QoS level of the group, and the system boosts
+ * all threads of the group together around each frame instead of boosting each thread separately. For example, the
+ * render, audio and input threads of a game can be placed in one group with a frame period of 16666 us (60 Hz) so
+ * that they are scheduled consistently before each vsync.
+ *
+ * @param level QoS level of the threads in the group. For details, see {@link QoS_Level}.
+ * @param framePeriodUs Frame period of the group, in microseconds. The value **0** indicates that the group is not
+ *     frame-bound, and only the QoS level is applied.
+ * @param group Output parameter. The handle of the created group is written to this variable. If the operation fails,
+ *     {@link OH_QOS_INVALID_THREAD_GROUP_ID} is written instead. This parameter cannot be set to NULL.
+ * @return If the operation is successful, **0** is returned. If a parameter is invalid, the number of thread groups of
+ *     the process reaches the upper limit, or an internal error occurs, **-1** is returned.
+ * @see OH_QoS_DestroyThreadGroup
+ * @since 26.1.0
+ */
+int OH_QoS_CreateThreadGroup(QoS_Level level, unsigned int framePeriodUs, OH_QoS_ThreadGroup *group);
+
+/**
+ * @brief Destroys a thread group. The threads in the group are removed from the group and their QoS levels are reset,
+ * as if **OH_QoS_ResetThreadQoS()** is called on each of them. After this API is called, the group handle can no
+ * longer be used.
+ *
+ * @param group Handle to the thread group.
+ * @return If the operation is successful, **0** is returned. If the group is not found or an internal error occurs,
+ *     **-1** is returned.
+ * @since 26.1.0
+ */
+int OH_QoS_DestroyThreadGroup(OH_QoS_ThreadGroup group);
+
+/**
+ * @brief Adds a thread of the current process to a thread group. A thread belongs to at most one group; adding it to
+ * another group removes it from the previous one. While the thread is in the group, its QoS level is managed by the
+ * group and **OH_QoS_SetThreadQoS()** called on the thread fails.
+ *
+ * @param group Handle to the thread group.
+ * @param tid ID of the thread to add. The value **0** indicates the current thread.
+ * @return If the operation is successful, **0** is returned. If the group is not found, the thread does not belong to
+ *     the current process, or an internal error occurs, **-1** is returned.
+ * @see OH_QoS_RemoveThreadFromGroup
+ * @since 26.1.0
+ */
+int OH_QoS_AddThreadToGroup(OH_QoS_ThreadGroup group, int tid);
+
+/**
+ * @brief Removes a thread from a thread group and resets its QoS level.
+ *
+ * @param group Handle to the thread group.
+ * @param tid ID of the thread to remove. The value **0** indicates the current thread.
+ * @return If the operation is successful, **0** is returned. If the group is not found, the thread is not in the
+ *     group, or an internal error occurs, **-1** is returned.
+ * @since 26.1.0
+ */
+int OH_QoS_RemoveThreadFromGroup(OH_QoS_ThreadGroup group, int tid);
+
+/**
+ * @brief Changes the frame period of a thread group, for example, when the display refresh rate changes.
+ *
+ * @param group Handle to the thread group.
+ * @param framePeriodUs Frame period of the group, in microseconds. The value **0** indicates that the group is not
+ *     frame-bound.
+ * @return If the operation is successful, **0** is returned. If the group is not found or an internal error occurs,
+ *     **-1** is returned.
+ * @since 26.1.0
+ */
+int OH_QoS_SetThreadGroupFramePeriod(OH_QoS_ThreadGroup group, unsigned int framePeriodUs);
+
+/**
+ * @brief Marks the beginning of a frame for a thread group, typically on vsync. The system boosts all threads of the
+ * group from this point until **OH_QoS_ThreadGroupFrameEnd()** is called or one frame period elapses, whichever comes
+ * first.
+ *
+ * @param group Handle to the thread group.
+ * @return If the operation is successful, **0** is returned. If the group is not found or is not frame-bound, **-1**
+ *     is returned.
+ * @see OH_QoS_ThreadGroupFrameEnd
+ * @since 26.1.0
+ */
+int OH_QoS_ThreadGroupFrameBegin(OH_QoS_ThreadGroup group);
+
+/**
+ * @brief Marks the end of a frame for a thread group. The boost applied by **OH_QoS_ThreadGroupFrameBegin()** is
+ * released, and the frame is counted as overrun if it ends later than one frame period after its beginning.
+ *
+ * @param group Handle to the thread group.
+ * @return If the operation is successful, **0** is returned. If the group is not found or no frame has begun, **-1**
+ *     is returned.
+ * @see OH_QoS_ThreadGroupFrameBegin
+ * @since 26.1.0
+ */
+int OH_QoS_ThreadGroupFrameEnd(OH_QoS_ThreadGroup group);
+
+/**
+ * @brief Obtains the CPU utilization of a thread group since the group is created or since this API is last called
+ * for the group, and starts a new statistics window.
+ *
+ * @param group Handle to the thread group.
+ * @param stats Output parameter. The statistics are written to this variable as an {@link OH_QoS_ThreadGroupStats}
+ *     value. This parameter cannot be set to NULL.
+ * @return If the operation is successful, **0** is returned. If the group is not found, **stats** is NULL, or an
+ *     internal error occurs, **-1** is returned.
+ * @since 26.1.0
+ */
+int OH_QoS_GetThreadGroupStats(OH_QoS_ThreadGroup group, OH_QoS_ThreadGroupStats *stats);
 #ifdef __cplusplus
 };
 #endif
@@ -831,6 +831,360 @@ int OH_IPCParcel_WriteInterfaceToken(OHIPCParcel *parcel, const char *token);
 int OH_IPCParcel_ReadInterfaceToken(const OHIPCParcel *parcel, char **token, int32_t *len,
     OH_IPC_MemAllocator allocator);
 
+/**
+* @brief 共享内存区域对象，可通过OHIPCParcel对象传递而无需拷贝其内容。
+*
+* @syscap SystemCapability.Communication.IPC.Core
+* @since 26.1.0
+*/
+struct OHIPCSharedRegion;
+
+/**
+* @brief 共享内存区域对象，可通过OHIPCParcel对象传递而无需拷贝其内容。
+*
+* @syscap SystemCapability.Communication.IPC.Core
+* @since 26.1.0
+*/
+typedef struct OHIPCSharedRegion OHIPCSharedRegion;
+
+/**
+ * @brief 创建基于匿名共享内存的共享内存区域。在写入OHIPCParcel对象之前，该区域在调用进程中以可读写方式映射，并持有
+ * 一个引用。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param name 区域名称的指针，用于调试，可以为空。
+ * @param size 区域大小，单位为字节，必须大于0。
+ * @return 成功返回OHIPCSharedRegion对象指针；否则返回NULL。
+ * @since 26.1.0
+ */
+OHIPCSharedRegion* OH_IPCSharedRegion_Create(const char *name, uint64_t size);
+
+/**
+ * @brief 增加OHIPCSharedRegion对象的引用，例如在OHIPCParcel对象销毁后仍保持从其读取的区域处于映射状态。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region OHIPCSharedRegion对象的指针，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCSharedRegion_Retain(OHIPCSharedRegion *region);
+
+/**
+ * @brief 释放OHIPCSharedRegion对象的一个引用。最后一个引用释放时，区域被解除映射并关闭。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region OHIPCSharedRegion对象的指针。
+ * @since 26.1.0
+ */
+void OH_IPCSharedRegion_Release(OHIPCSharedRegion *region);
+
+/**
+ * @brief 获取OHIPCSharedRegion对象的可写地址。只有创建区域的进程可以写入，且仅限于区域写入OHIPCParcel对象之前，写入
+ * 时区域会被封存。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region OHIPCSharedRegion对象的指针，不能为空。
+ * @return 返回区域的可写地址；参数不合法、区域是从OHIPCParcel对象读取的或区域已被
+ * {@link OH_IPCParcel_WriteSharedRegion}封存时返回NULL。
+ * @since 26.1.0
+ */
+uint8_t* OH_IPCSharedRegion_GetWritableData(OHIPCSharedRegion *region);
+
+/**
+ * @brief 获取OHIPCSharedRegion对象的可读地址。从OHIPCParcel对象读取的区域在接收进程中以只读方式映射。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region OHIPCSharedRegion对象的指针，不能为空。
+ * @return 返回区域的可读地址；参数不合法时返回NULL。
+ * @since 26.1.0
+ */
+const uint8_t* OH_IPCSharedRegion_GetData(const OHIPCSharedRegion *region);
+
+/**
+ * @brief 获取OHIPCSharedRegion对象的大小。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param region OHIPCSharedRegion对象的指针，不能为空。
+ * @return 返回区域大小，单位为字节；参数不合法时返回0。
+ * @since 26.1.0
+ */
+uint64_t OH_IPCSharedRegion_GetSize(const OHIPCSharedRegion *region);
+
+/**
+ * @brief 向OHIPCParcel对象写入OHIPCSharedRegion对象。仅写入区域句柄，不拷贝区域内容。在调用
+ * {@link OH_IPCParcel_Destroy}之前，Parcel持有该区域的一个引用。
+ * <br>写入句柄前会封存该区域，使接收方无法观察到之后的修改：创建方的可写映射被替换为只读映射，底层内存通过
+ * **F_SEAL_WRITE**（memfd）封存或设置为只读保护（ashmem）。封存不可撤销，此后{@link OH_IPCSharedRegion_GetWritableData}
+ * 返回NULL。允许再次写入已封存的区域。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param region 需要写入的OHIPCSharedRegion对象指针，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 写入或封存失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WriteSharedRegion(OHIPCParcel *parcel, OHIPCSharedRegion *region);
+
+/**
+ * @brief 从OHIPCParcel对象读取OHIPCSharedRegion对象，并以只读方式映射。区域归Parcel所有，除非调用
+ * {@link OH_IPCSharedRegion_Retain}，否则在{@link OH_IPCParcel_Destroy}时解除映射。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param region 存储读取的OHIPCSharedRegion对象的二级指针，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 读取或映射失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadSharedRegion(const OHIPCParcel *parcel, OHIPCSharedRegion **region);
+
+/**
+ * @brief 设置{@link OH_IPCParcel_WriteLargeBuffer}改用共享内存区域传递数据、而不拷贝进Parcel的大小阈值。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param threshold 大小阈值，单位为字节，默认值为16384。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_SetSharedRegionThreshold(OHIPCParcel *parcel, uint32_t threshold);
+
+/**
+ * @brief 向OHIPCParcel对象写入指定长度的数据。小于{@link OH_IPCParcel_SetSharedRegionThreshold}所设阈值的数据与
+ * {@link OH_IPCParcel_WriteBuffer}一样拷贝进Parcel；更大的数据只拷贝一次到新建的共享内存区域，并将该区域写入Parcel，
+ * 因此不受Parcel大小限制，传递给接收端时也不会再次拷贝。拷贝进Parcel的数据会填充到从Parcel数据中8字节对齐的地址开始。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param buffer 需要写入的数据指针，不能为空。
+ * @param len 需要写入的数据长度，单位为字节。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 写入失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WriteLargeBuffer(OHIPCParcel *parcel, const uint8_t *buffer, uint64_t len);
+
+/**
+ * @brief 从OHIPCParcel对象读取由{@link OH_IPCParcel_WriteLargeBuffer}写入的数据，不进行拷贝。返回的地址指向Parcel
+ * 内部或只读的共享内存区域，在调用{@link OH_IPCParcel_Destroy}之前有效。
+ * <br>数据位于Parcel内部时地址按8字节对齐，位于共享内存区域时按页对齐。需要按对齐要求超过8字节的类型访问数据时，需先通过
+ * memcpy拷贝出数据。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param buffer 存储读取数据地址的指针，不能为空。
+ * @param len 存储读取数据长度的指针，单位为字节，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 读取失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadLargeBuffer(const OHIPCParcel *parcel, const uint8_t **buffer, uint64_t *len);
+
+/**
+ * @brief 从调用线程的Parcel池中获取OHIPCParcel对象，池为空时创建新对象。获取的对象为空，且至少预留capacityHint字节
+ * 的数据空间，写入不超过该大小的数据时不会重新分配内存。使用完毕后可通过{@link OH_IPCParcel_Recycle}归还复用，或通过
+ * {@link OH_IPCParcel_Destroy}销毁。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param capacityHint 预计的数据大小，单位为字节。取值为0时不预留。不能超过OHIPCParcel对象的最大大小。
+ * @return 成功返回OHIPCParcel对象指针；否则返回NULL。
+ * @since 26.1.0
+ */
+OHIPCParcel* OH_IPCParcel_Acquire(uint32_t capacityHint);
+
+/**
+ * @brief 将OHIPCParcel对象归还到调用线程的Parcel池。对象按{@link OH_IPCParcel_Reset}的方式重置，并保留其数据缓冲区。
+ * 若池中已有8个对象，则直接销毁该对象。调用该函数后不能再使用该对象。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel 需要归还的OHIPCParcel对象指针。
+ * @since 26.1.0
+ */
+void OH_IPCParcel_Recycle(OHIPCParcel *parcel);
+
+/**
+ * @brief 为OHIPCParcel对象预留数据空间，写入不超过指定大小的数据时不会重新分配内存。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param capacity 需要预留的数据大小，单位为字节。不能超过OHIPCParcel对象的最大大小。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 内存分配失败返回{@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_Reserve(OHIPCParcel *parcel, uint32_t capacity);
+
+/**
+ * @brief 清空OHIPCParcel对象以便复用。读写位置重置为0，Parcel持有的文件描述符、远端对象等被释放，但保留数据缓冲区。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_Reset(OHIPCParcel *parcel);
+
+/**
+ * @brief {@link OH_IPCParcel_ReadStringInArena}使用的调用者管理的内存区。内存由调用者提供，将used重置为0即可复用。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 内存区起始地址。 */
+    uint8_t *base;
+    /** 内存区大小，单位为字节。 */
+    uint32_t size;
+    /** 已使用的字节数。 */
+    uint32_t used;
+} OH_IPC_Arena;
+
+/**
+ * @brief 从OHIPCParcel对象读取字符串，并将其连同结束符拷贝到调用者提供的内存区。与{@link OH_IPCParcel_ReadString}
+ * 不同，Parcel被重置、归还或销毁后字符串依然有效，且不申请内存。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param arena 内存区指针，不能为空。
+ * @param str 存储读取字符串地址的指针，不能为空。
+ * @param len 存储读取字符串长度（不含结束符）的指针，可以为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 读取失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR}；
+ * 内存区空间不足返回{@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR}，此时读取位置不变。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadStringInArena(const OHIPCParcel *parcel, OH_IPC_Arena *arena, const char **str, int32_t *len);
+
+/**
+ * @brief 结构体描述中可使用的字段类型。
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** int8_t字段。 */
+    OH_IPC_FIELD_INT8 = 0,
+    /** int16_t字段。 */
+    OH_IPC_FIELD_INT16 = 1,
+    /** int32_t字段。 */
+    OH_IPC_FIELD_INT32 = 2,
+    /** int64_t字段。 */
+    OH_IPC_FIELD_INT64 = 3,
+    /** uint8_t字段。 */
+    OH_IPC_FIELD_UINT8 = 4,
+    /** uint16_t字段。 */
+    OH_IPC_FIELD_UINT16 = 5,
+    /** uint32_t字段。 */
+    OH_IPC_FIELD_UINT32 = 6,
+    /** uint64_t字段。 */
+    OH_IPC_FIELD_UINT64 = 7,
+    /** float字段。 */
+    OH_IPC_FIELD_FLOAT = 8,
+    /** double字段。 */
+    OH_IPC_FIELD_DOUBLE = 9,
+    /** 指向以'\0'结尾字符串的const char *字段。 */
+    OH_IPC_FIELD_STRING = 10,
+} OH_IPC_FieldType;
+
+/**
+ * @brief 描述通过{@link OH_IPCParcel_WriteStruct}序列化的结构体中的一个字段。描述数组即结构体的描述，写入端和读取端
+ * 必须使用相同的描述。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 字段在结构体中的偏移，通常通过offsetof获取。 */
+    uint32_t offset;
+    /** 字段类型。 */
+    OH_IPC_FieldType type;
+    /**
+     * 元素个数。取值为1表示标量字段，大于1表示内嵌在结构体中的定长数组。{@link OH_IPC_FIELD_STRING}类型只能为1。
+     */
+    uint32_t count;
+} OH_IPC_FieldDesc;
+
+/**
+ * @brief 按描述向OHIPCParcel对象写入结构体。描述只校验一次、所需空间只预留一次，相邻的数值字段通过一次内存拷贝写入，
+ * 比逐个字段写入更快。
+ * <br>字段数据之前会写入每个字段的类型和元素个数，以便{@link OH_IPCParcel_ReadStruct}检测描述不一致。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param fields 字段描述数组指针，不能为空。
+ * @param fieldCount 字段描述个数，必须大于0。
+ * @param object 需要写入的结构体指针，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 写入失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR}，此时写入位置不变。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WriteStruct(OHIPCParcel *parcel, const OH_IPC_FieldDesc *fields, uint32_t fieldCount,
+    const void *object);
+
+/**
+ * @brief 从OHIPCParcel对象读取由{@link OH_IPCParcel_WriteStruct}写入的结构体。字符串字段拷贝到指定的内存区。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param fields 字段描述数组指针，必须与写入时相同，不能为空。
+ * @param fieldCount 字段描述个数，必须大于0。
+ * @param object 需要填写的结构体指针，不能为空。
+ * @param arena 存放读取字符串的内存区指针。仅当描述中没有字符串字段时可以为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 读取失败，或fields中的字段个数、字段类型、字段元素个数与{@link OH_IPCParcel_WriteStruct}记录的描述不一致时返回
+ * {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR}；
+ * 内存区空间不足返回{@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR}。
+ * 失败时读取位置不变。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadStruct(const OHIPCParcel *parcel, const OH_IPC_FieldDesc *fields, uint32_t fieldCount,
+    void *object, OH_IPC_Arena *arena);
+
+/**
+ * @brief 向OHIPCParcel对象写入纯数据元素（如整数或不含指针的结构体）数组。先写入元素大小和元素个数，
+ * 再通过一次内存拷贝写入所有元素。写入元素前会插入填充，使元素从Parcel数据中8字节对齐的地址开始。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param data 数组指针。仅当count为0时可以为空。
+ * @param elementSize 单个元素的大小，单位为字节，必须大于0。
+ * @param count 元素个数。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 写入失败返回{@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_WritePodArray(OHIPCParcel *parcel, const void *data, uint32_t elementSize, uint32_t count);
+
+/**
+ * @brief 从OHIPCParcel对象读取由{@link OH_IPCParcel_WritePodArray}写入的数组，不进行拷贝。返回的地址指向Parcel数据，
+ * 在Parcel被重置或销毁之前有效。
+ * <br>返回的地址按8字节对齐，可直接作为对齐要求不超过8字节的任意元素类型的数组访问。元素类型的对齐要求更严格时，需先通过
+ * memcpy拷贝出数据再使用。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel OHIPCParcel对象的指针，不能为空。
+ * @param elementSize 单个元素的大小，单位为字节，必须与写入时相同。
+ * @param data 存储读取数组地址的指针，不能为空。
+ * @param count 存储读取元素个数的指针，不能为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 读取失败，或elementSize与{@link OH_IPCParcel_WritePodArray}记录的元素大小不一致时返回
+ * {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR}。
+ * 失败时读取位置不变。
+ * @since 26.1.0
+ */
+int OH_IPCParcel_ReadPodArray(const OHIPCParcel *parcel, uint32_t elementSize, const void **data, uint32_t *count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -225,6 +225,97 @@ typedef struct {
 int OH_IPCRemoteProxy_SendRequest(const OHIPCRemoteProxy *proxy, uint32_t code, const OHIPCParcel *data,
     OHIPCParcel *reply, const OH_IPC_MessageOption *option);
 
+/**
+ * @brief {@link OH_IPCRemoteProxy_SendBatchRequest}发送的批量请求中的单个请求。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 用户定义的IPC命令字，范围：[0x01, 0x00ffffff]。 */
+    uint32_t code;
+    /** 请求数据对象指针，不能为空。 */
+    const OHIPCParcel *data;
+    /** 回应数据对象指针。异步批量请求时可以为空。 */
+    OHIPCParcel *reply;
+    /**
+     * 请求结果。同步批量请求时为Stub端返回的结果，批量请求完成时填写；异步批量请求不返回Stub端的结果，批量请求发送后置为
+     * {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}。
+     */
+    int result;
+} OH_IPC_BatchRequest;
+
+/**
+ * @brief 在一次传输中向同一远端对象发送多条IPC消息。Stub端按数组顺序处理请求，每个请求调用一次其
+ * {@link OH_OnRemoteRequestCallback}。同步批量请求在函数返回前填写每个请求的结果和回应；异步批量请求在发送后即返回，仅按
+ * {@link OH_IPC_BatchRequest}的说明填写result成员。交互频繁的接口可借此将上下文切换开销分摊到
+ * 整个批次。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy OHIPCRemoteProxy对象指针，不能为空。
+ * @param requests 请求数组指针，不能为空。
+ * @param count 数组中的请求个数，范围：[1, 256]。
+ * @param option 消息选项指针，可以为空，为空时为同步批量请求。异步批量请求不填写回应。
+ * @return 发送成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}，每个请求的结果通过其result成员返回；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 远端OHIPCRemoteStub对象死亡返回{@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT}；
+ * code超出范围返回{@link OH_IPC_ErrorCode#OH_IPC_CODE_OUT_OF_RANGE}；
+ * 其它返回{@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCRemoteProxy_SendBatchRequest(const OHIPCRemoteProxy *proxy, OH_IPC_BatchRequest *requests,
+    uint32_t count, const OH_IPC_MessageOption *option);
+
+/**
+ * @brief 收到{@link OH_IPCRemoteProxy_SendRequestAsync}所发请求的回应时调用的回调函数。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param result 请求结果，取值与{@link OH_IPCRemoteProxy_SendRequest}的返回值相同。
+ * @param reply 回应数据对象指针。请求失败时为空，不能在回调中释放，也不能在回调返回后使用。
+ * @param userData 用户私有数据指针，可以为空。
+ * @since 26.1.0
+ */
+typedef void (*OH_OnRemoteReplyCallback)(int result, const OHIPCParcel *reply, void *userData);
+
+/**
+ * @brief 以不阻塞的方式发送IPC消息，并通过回调返回回应。短时间内发往同一Proxy的请求会流水线化：尽可能合并到较少的
+ * 传输中，由Stub端按发送顺序处理，回调也按相同顺序在IPC线程上调用。
+ * <br>当该Proxy排队的请求达到16个，或最早排队的请求已排队1ms时（以先到者为准）发送排队的请求；调用
+ * {@link OH_IPCRemoteProxy_FlushAsyncRequests}时会提前发送。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy OHIPCRemoteProxy对象指针，不能为空。
+ * @param code 用户定义的IPC命令字，范围：[0x01, 0x00ffffff]。
+ * @param data 请求数据对象指针，不能为空。函数返回后即可销毁或复用。
+ * @param callback 携带回应的回调函数，不能为空。
+ * @param userData 传给回调的用户私有数据指针，可以为空。
+ * @return 请求入队成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数不合法时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 远端OHIPCRemoteStub对象死亡返回{@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT}；
+ * code超出范围返回{@link OH_IPC_ErrorCode#OH_IPC_CODE_OUT_OF_RANGE}；
+ * 其它返回{@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCRemoteProxy_SendRequestAsync(const OHIPCRemoteProxy *proxy, uint32_t code, const OHIPCParcel *data,
+    OH_OnRemoteReplyCallback callback, void *userData);
+
+/**
+ * @brief 立即发送{@link OH_IPCRemoteProxy_SendRequestAsync}排队的请求，并等待其所有回调执行完毕或等待超时。不能在
+ * {@link OH_OnRemoteReplyCallback}或{@link OH_OnRemoteRequestCallback}中调用该函数，否则等待可能导致IPC线程死锁；此类调用
+ * 不发送任何请求，直接返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * 超时不视为错误：仍未完成的请求数通过pendingCount返回，其回调之后照常调用。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy OHIPCRemoteProxy对象指针，不能为空。
+ * @param timeoutMs 最长等待时间，单位为毫秒。取值为0时仅发送排队的请求，不等待。
+ * @param pendingCount 函数返回时回调尚未执行的请求数的指针。取值为0表示所有回调均已执行。可以为空。
+ * @return 排队的请求发送成功时返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}，无论超时前所有回调是否已执行完毕；
+ * 参数不合法或在回应、请求回调中调用时返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}；
+ * 远端OHIPCRemoteStub对象死亡返回{@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT}；
+ * 请求发送失败返回{@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCRemoteProxy_FlushAsyncRequests(const OHIPCRemoteProxy *proxy, uint32_t timeoutMs, uint32_t *pendingCount);
+
 /**
  * @brief 从Stub端获取接口描述符。接口描述符是Stub对象的唯一标识，用于识别远端服务类型、进行服务版本兼容性检查或者验证远端服务是否实现了特定接口。函数通过IPC调用从远端Stub获取描述符字符串，
  * 并使用用户提供的内存分配器存储结果。
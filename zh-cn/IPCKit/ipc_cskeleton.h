@@ -205,6 +205,135 @@ int OH_IPCSkeleton_SetCallingIdentity(const char *identity);
  */
 int OH_IPCSkeleton_IsHandlingTransaction(void);
 
+/**
+ * @brief {@link OH_IPC_CallStats}中时延直方图的桶数。
+ *
+ * @since 26.1.0
+ */
+#define OH_IPC_CALL_LATENCY_BUCKET_NUM 20
+
+/**
+ * @brief IPC调用的记录端。
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** 通过OHIPCRemoteProxy对象发送的请求。 */
+    OH_IPC_CALL_SIDE_PROXY = 0,
+    /** 由OHIPCRemoteStub对象处理的请求。 */
+    OH_IPC_CALL_SIDE_STUB = 1,
+} OH_IPC_CallSide;
+
+/**
+ * @brief 同一接口描述符和请求码的IPC调用统计信息。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 接口描述符，仅在{@link OH_IPC_CallStatsCallback}调用期间有效。 */
+    const char *descriptor;
+    /** 请求码。 */
+    uint32_t code;
+    /** 调用的记录端。 */
+    OH_IPC_CallSide side;
+    /** 调用次数。 */
+    uint64_t callCount;
+    /** 返回值不为{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}的调用次数。 */
+    uint64_t failCount;
+    /** 请求数据总大小，单位为字节。 */
+    uint64_t bytesOut;
+    /** 回应数据总大小，单位为字节。 */
+    uint64_t bytesIn;
+    /** 总时延，单位为微秒。 */
+    uint64_t totalLatencyUs;
+    /** 最大时延，单位为微秒。 */
+    uint64_t maxLatencyUs;
+    /**
+     * 时延直方图。桶0统计小于2微秒的调用，桶i统计[2^i, 2^(i+1))微秒的调用，最后一个桶同时统计更长的调用。
+     */
+    uint64_t latencyHistogram[OH_IPC_CALL_LATENCY_BUCKET_NUM];
+} OH_IPC_CallStats;
+
+/**
+ * @brief {@link OH_IPCSkeleton_ForEachCallStats}对每个条目调用一次的回调函数。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param stats 统计条目指针，仅在回调期间有效。
+ * @param userData 用户私有数据指针，可以为空。
+ * @since 26.1.0
+ */
+typedef void (*OH_IPC_CallStatsCallback)(const OH_IPC_CallStats *stats, void *userData);
+
+/**
+ * @brief 开启或关闭本进程的IPC调用统计。开启后，每个发送或处理的请求按接口描述符和请求码记录，使用线程级计数，调用
+ * 路径上不加锁。默认关闭。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param enable 是否开启统计。1表示开启，0表示关闭。
+ * @param traceEnable 是否同时将每次调用输出为名为"IPC:{descriptor}#{code}"的HiTrace异步打点，并将每次死亡通知输出为
+ * HiTrace事件。1表示输出，0表示不输出。enable为0时忽略。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数错误返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCSkeleton_EnableCallStats(int enable, int traceEnable);
+
+/**
+ * @brief 遍历本进程的IPC调用统计。调用回调前先将线程级计数合并为一致的快照，遍历期间发生的调用不会改变该快照。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param callback 对每个条目调用的回调函数，不能为空。
+ * @param userData 传给回调的用户私有数据指针，可以为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数错误返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCSkeleton_ForEachCallStats(OH_IPC_CallStatsCallback callback, void *userData);
+
+/**
+ * @brief 单个接口描述符的死亡通知统计。死亡通知与请求码和记录端无关，因此按描述符单独上报，而不放在
+ * {@link OH_IPC_CallStats}中。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 接口描述符，仅在{@link OH_IPC_DeathStatsCallback}调用期间有效。 */
+    const char *descriptor;
+    /** 该描述符的远端对象收到的死亡通知次数。 */
+    uint64_t deathCount;
+} OH_IPC_DeathStats;
+
+/**
+ * @brief {@link OH_IPCSkeleton_ForEachDeathStats}对每个描述符调用一次的回调函数。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param stats 统计条目指针，仅在回调期间有效。
+ * @param userData 用户私有数据指针，可以为空。
+ * @since 26.1.0
+ */
+typedef void (*OH_IPC_DeathStatsCallback)(const OH_IPC_DeathStats *stats, void *userData);
+
+/**
+ * @brief 遍历本进程的死亡通知统计，该统计在通过{@link OH_IPCSkeleton_EnableCallStats}开启调用统计期间记录。没有收到
+ * 死亡通知的描述符会被跳过。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param callback 对每个描述符调用的回调函数，不能为空。
+ * @param userData 传给回调的用户私有数据指针，可以为空。
+ * @return 成功返回{@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}；
+ * 参数错误返回{@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR}。
+ * @since 26.1.0
+ */
+int OH_IPCSkeleton_ForEachDeathStats(OH_IPC_DeathStatsCallback callback, void *userData);
+
+/**
+ * @brief 清空本进程的IPC调用统计和死亡通知统计。
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @since 26.1.0
+ */
+void OH_IPCSkeleton_ResetCallStats(void);
+
 #ifdef __cplusplus
 }
 #endif
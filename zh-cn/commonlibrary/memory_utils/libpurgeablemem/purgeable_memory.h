@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -188,6 +188,87 @@ size_t OH_PurgeableMemory_ContentSize(OH_PurgeableMemory *purgObj);
 bool OH_PurgeableMemory_AppendModify(OH_PurgeableMemory *purgObj,
     OH_PurgeableMemory_ModifyFunc func, void *funcPara);
 
+/**
+ * @brief 可丢弃内存池结构。
+ * <br>内存池将大量小的可丢弃内存对象打包到共享映射中，每个对象无需单独的映射。
+ *
+ * @since 26.1.0
+ */
+typedef struct PurgMemPool OH_PurgeableMemoryPool;
+
+/**
+ * @brief 可丢弃内存池的统计信息。
+ *
+ * @since 26.1.0
+ */
+typedef struct OH_PurgeableMemoryPool_Stats {
+    /** 从内存池分配且尚未销毁的对象数。 */
+    size_t objectCount;
+    /** 内容驻留的对象的内容大小总和。 */
+    size_t residentBytes;
+    /** 内容已被清除且尚未重建的对象的内容大小总和。 */
+    size_t purgedBytes;
+    /** 内存池持有的共享映射总大小，包括空闲空间。 */
+    size_t mappedBytes;
+    /** 自内存池创建以来对象内容被重建的次数。 */
+    size_t rebuildCount;
+} OH_PurgeableMemoryPool_Stats;
+
+/**
+ * @brief 创建可丢弃内存池。
+ *
+ *
+ * @param chunkSize 内存池每个共享映射的大小，向上取整为页大小的整数倍。
+ *     <br>传入0表示使用默认大小。
+ * @return 可丢弃内存池，创建失败时返回NULL。
+ *
+ * @since 26.1.0
+ */
+OH_PurgeableMemoryPool *OH_PurgeableMemoryPool_Create(size_t chunkSize);
+
+/**
+ * @brief 销毁可丢弃内存池。
+ *
+ *
+ * @param pool 待销毁的可丢弃内存池。
+ * @return 销毁结果，true 表示成功，false 表示失败。如果 pool 为 NULL，则返回 true。
+ *     <br>如果从内存池分配的对象尚未销毁，则返回 false。
+ *
+ * @since 26.1.0
+ */
+bool OH_PurgeableMemoryPool_Destroy(OH_PurgeableMemoryPool *pool);
+
+/**
+ * @brief 从可丢弃内存池分配可丢弃内存对象。
+ *
+ * 该对象与内存池中的其他对象打包存放，清除状态按对象而不是按页跟踪。返回的对象与 OH_PurgeableMemory_Create()
+ * 返回的对象使用相同的接口，并通过 OH_PurgeableMemory_Destroy() 销毁。
+ * <br>分配时不构建内容。首次调用 OH_PurgeableMemory_BeginRead() 或 OH_PurgeableMemory_BeginWrite() 时通过 func 构建内容，
+ * 内容被清除后以同样方式重建。
+ *
+ * @param pool 可丢弃内存池。
+ * @param size 可丢弃内存对象内容的数据大小。
+ * @param func 函数指针，用于在可丢弃内存对象的内容不存在时构建数据。
+ * @param funcPara func使用的参数。
+ * @return 可丢弃内存对象。如果 pool 或 func 为 NULL、size 为 0 或分配失败，则返回 NULL。
+ *
+ * @since 26.1.0
+ */
+OH_PurgeableMemory *OH_PurgeableMemoryPool_Alloc(OH_PurgeableMemoryPool *pool,
+    size_t size, OH_PurgeableMemory_ModifyFunc func, void *funcPara);
+
+/**
+ * @brief 获取可丢弃内存池的统计信息。
+ *
+ *
+ * @param pool 可丢弃内存池。
+ * @param stats 待填写的统计信息。
+ * @return 获取结果，true 表示成功，false 表示失败。如果 pool 或 stats 为 NULL，则返回 false。
+ *
+ * @since 26.1.0
+ */
+bool OH_PurgeableMemoryPool_GetStats(OH_PurgeableMemoryPool *pool, OH_PurgeableMemoryPool_Stats *stats);
+
 #ifdef __cplusplus
 }
 #endif /* End of #ifdef __cplusplus */
@@ -37,6 +37,9 @@
 #ifndef GLOBAL_RAW_DIR_H
 #define GLOBAL_RAW_DIR_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -87,6 +90,106 @@ int OH_ResourceManager_GetRawFileCount(RawDir *rawDir);
  */
 void OH_ResourceManager_CloseRawDir(RawDir *rawDir);
 
+/**
+ * @brief RawFileIndex表示rawfile目录下所有路径的只读快照，通过哈希表索引，可在常数时间内查找。通过
+ * {@link OH_ResourceManager_CreateRawFileIndex}获取，使用完后须通过{@link OH_ResourceManager_ReleaseRawFileIndex}释放。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct RawFileIndex RawFileIndex;
+
+/**
+ * @brief RawFileIndex中路径的类型。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef enum {
+    /** 路径不存在。 */
+    RAWFILE_ENTRY_NONE = 0,
+    /** 路径为文件。 */
+    RAWFILE_ENTRY_FILE = 1,
+    /** 路径为目录。 */
+    RAWFILE_ENTRY_DIR = 2,
+} RawFileEntryType;
+
+/**
+ * @brief {@link OH_ResourceManager_ListRawFileIndexByPrefix}或{@link OH_ResourceManager_ListRawFileIndexByGlob}对每个
+ * 匹配路径调用的回调函数。
+ *
+ * @param path 输入参数。相对于rawfile根目录的路径，指向快照内部，在索引释放前有效，不为其申请内存。
+ * @param type 输入参数。路径的类型。
+ * @param userData 输入参数。传给列举函数的用户数据指针。
+ * @return 返回true表示继续列举，返回false表示停止。
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef bool (*OH_ResourceManager_OnRawFileIndexEntry)(const char *path, RawFileEntryType type, void *userData);
+
+/**
+ * @brief 在常数时间内于RawFileIndex中查找路径，无需经过资源管理器。可替代{@link OH_ResourceManager_IsRawDir}以及打开
+ * 文件前判断文件是否存在的操作。
+ *
+ * @param index 输入参数。指向RawFileIndex对象的指针，通过{@link OH_ResourceManager_CreateRawFileIndex}获取。
+ * @param path 输入参数。相对于rawfile根目录的路径，例如"images/icons/1.png"。
+ * @param size 输出参数。指向文件长度的指针，单位为Byte。路径为目录时置为0。可以为NULL。
+ * @return 返回路径的类型。若路径不存在或index、path为NULL，则返回{@link RAWFILE_ENTRY_NONE}。
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileEntryType OH_ResourceManager_LookupRawFileIndex(const RawFileIndex *index, const char *path, int64_t *size);
+
+/**
+ * @brief 按字典序列举RawFileIndex中以指定前缀开头的路径。快照中的路径有序存储，列举即为一次区间扫描。
+ *
+ * @param index 输入参数。指向RawFileIndex对象的指针，通过{@link OH_ResourceManager_CreateRawFileIndex}获取。
+ * @param prefix 输入参数。路径前缀，例如"images/"。取值为空字符串时列举所有路径。
+ * @param callback 输入参数。对每个匹配路径调用的回调函数。
+ * @param userData 输入参数。传给回调的用户数据指针，可以为NULL。
+ * @return 返回传给回调的路径个数。若index、prefix或callback为NULL，则返回-1。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_ResourceManager_ListRawFileIndexByPrefix(const RawFileIndex *index, const char *prefix,
+    OH_ResourceManager_OnRawFileIndexEntry callback, void *userData);
+
+/**
+ * @brief 按字典序列举RawFileIndex中匹配指定glob模式的路径。
+ * <br>`*`匹配除`/`以外的任意字符，`?`匹配除`/`以外的单个字符，`**`匹配包括`/`在内的任意字符。第一个通配符之前的字面
+ * 部分用作前缀以缩小扫描范围。
+ *
+ * @param index 输入参数。指向RawFileIndex对象的指针，通过{@link OH_ResourceManager_CreateRawFileIndex}获取。
+ * @param pattern 输入参数。glob模式，例如"textures/ui_*.png"。
+ * @param callback 输入参数。对每个匹配路径调用的回调函数。
+ * @param userData 输入参数。传给回调的用户数据指针，可以为NULL。
+ * @return 返回传给回调的路径个数。若index、pattern或callback为NULL，则返回-1。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_ResourceManager_ListRawFileIndexByGlob(const RawFileIndex *index, const char *pattern,
+    OH_ResourceManager_OnRawFileIndexEntry callback, void *userData);
+
+/**
+ * @brief 获取RawFileIndex中文件和目录的总数，递归统计。
+ *
+ * @param index 输入参数。指向RawFileIndex对象的指针，通过{@link OH_ResourceManager_CreateRawFileIndex}获取。
+ * @return 返回路径个数。若index为NULL，则返回0。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int OH_ResourceManager_GetRawFileIndexCount(const RawFileIndex *index);
+
+/**
+ * @brief 释放RawFileIndex对象。进程内同一HAP的所有索引共享同一个快照，最后一个索引释放时释放快照。
+ *
+ * @param index 输入参数。指向RawFileIndex对象的指针，通过{@link OH_ResourceManager_CreateRawFileIndex}获取。释放后该
+ *     指针及从中获取的所有路径失效。
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_ResourceManager_ReleaseRawFileIndex(RawFileIndex *index);
+
 #ifdef __cplusplus
 };
 #endif
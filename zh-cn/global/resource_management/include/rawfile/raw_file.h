@@ -337,6 +337,91 @@ bool OH_ResourceManager_GetRawFileDescriptor64(const RawFile64 *rawFile, RawFile
  */
 bool OH_ResourceManager_ReleaseRawFileDescriptor64(const RawFileDescriptor64 *descriptor);
 
+/**
+ * @brief RawFileMapping表示rawfile文件的只读内存映射视图。通过{@link OH_ResourceManager_MapRawFile}获取，使用完后须
+ * 通过{@link OH_ResourceManager_UnmapRawFile}释放。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct RawFileMapping RawFileMapping;
+
+/**
+ * @brief rawfile内存映射的访问模式提示，通过madvise传递给内核。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef enum {
+    /** 无特殊提示。 */
+    RAWFILE_MAP_ADVICE_NORMAL = 0,
+    /** 按顺序读取映射，内核积极预读。 */
+    RAWFILE_MAP_ADVICE_SEQUENTIAL = 1,
+    /** 随机读取映射，内核不预读。 */
+    RAWFILE_MAP_ADVICE_RANDOM = 2,
+    /** 映射即将被读取，内核在后台开始加载。 */
+    RAWFILE_MAP_ADVICE_WILLNEED = 3,
+} RawFileMapAdvice;
+
+/**
+ * @brief 将rawfile文件以只读视图映射到内存，不拷贝文件内容。视图直接建立在HAP文件上，页面按需加载，并与系统中同一
+ * rawfile的其他映射共享。
+ * <br>进程内同一rawfile的多个映射共享同一个底层视图，该视图按引用计数管理，最后一个映射释放时解除映射。rawFile关闭后
+ * 映射依然有效。
+ *
+ * @param rawFile 输入参数。指向RawFile64对象的指针，通过{@link OH_ResourceManager_OpenRawFile64}获取。
+ * @param advice 输入参数。整个映射的访问模式提示。
+ * @return 返回指向RawFileMapping对象的指针。失败时返回NULL，可能原因是rawFile为NULL、rawfile文件在HAP中被压缩或内存映射失败。
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileMapping *OH_ResourceManager_MapRawFile(const RawFile64 *rawFile, RawFileMapAdvice advice);
+
+/**
+ * @brief 获取映射中rawfile文件内容的起始地址。底层视图在HAP内按页对齐，返回的地址指向视图中rawfile文件的第一个字节。
+ *
+ * @param mapping 输入参数。指向RawFileMapping对象的指针，通过{@link OH_ResourceManager_MapRawFile}获取。
+ * @return 返回rawfile文件内容的起始地址，只读，在映射释放前有效。若mapping为NULL，则返回NULL。
+ * @since 26.1.0
+ * @version 1.0
+ */
+const void *OH_ResourceManager_GetRawFileMappingData(const RawFileMapping *mapping);
+
+/**
+ * @brief 获取映射中rawfile文件内容的长度，单位为Byte。
+ *
+ * @param mapping 输入参数。指向RawFileMapping对象的指针，通过{@link OH_ResourceManager_MapRawFile}获取。
+ * @return 返回rawfile文件内容的长度。若mapping为NULL，则返回0。
+ * @since 26.1.0
+ * @version 1.0
+ */
+int64_t OH_ResourceManager_GetRawFileMappingSize(const RawFileMapping *mapping);
+
+/**
+ * @brief 为映射的指定范围设置访问模式提示，例如通过{@link RAWFILE_MAP_ADVICE_WILLNEED}预加载模型中最先使用的部分。
+ * 范围会扩展到页边界。
+ *
+ * @param mapping 输入参数。指向RawFileMapping对象的指针，通过{@link OH_ResourceManager_MapRawFile}获取。
+ * @param offset 输入参数。范围相对rawfile文件内容的起始位置，单位为Byte。
+ * @param length 输入参数。范围长度，单位为Byte。取值为0表示到rawfile文件末尾。
+ * @param advice 输入参数。该范围的访问模式提示。
+ * @return 返回设置结果。true表示成功。false表示失败，可能原因是mapping为NULL或范围超出rawfile文件。
+ * @since 26.1.0
+ * @version 1.0
+ */
+bool OH_ResourceManager_AdviseRawFileMapping(const RawFileMapping *mapping, int64_t offset, int64_t length,
+    RawFileMapAdvice advice);
+
+/**
+ * @brief 释放rawfile文件映射。进程内该rawfile的最后一个映射释放时，解除底层视图的映射。
+ *
+ * @param mapping 输入参数。指向RawFileMapping对象的指针，通过{@link OH_ResourceManager_MapRawFile}获取。释放后该指针及
+ *     通过{@link OH_ResourceManager_GetRawFileMappingData}获取的地址失效。
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_ResourceManager_UnmapRawFile(RawFileMapping *mapping);
+
 #ifdef __cplusplus
 };
 #endif
@@ -127,6 +127,126 @@ RawFile64 *OH_ResourceManager_OpenRawFile64(const NativeResourceManager *mgr, co
  */
 bool OH_ResourceManager_IsRawDir(const NativeResourceManager *mgr, const char *path);
 
+/**
+ * @brief 描述通过{@link OH_ResourceManager_ReadRawFilesAsync}提交的批量读取中的一次读取。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct {
+    /**
+     * 待读取的文件路径。相对于rawfile根目录的路径，例如"images/icons/1.png"。
+     */
+    const char *fileName;
+
+    /**
+     * 接收读取数据的缓冲区，至少能容纳length个字节。由开发者自行分配内存，读取完成前不能释放。
+     */
+    void *buf;
+
+    /**
+     * 在rawfile文件中开始读取的偏移位置，单位为Byte。
+     */
+    int64_t offset;
+
+    /**
+     * 期望读取的数据长度，单位为Byte。取值为-1表示读取到文件末尾。
+     */
+    int64_t length;
+
+    /**
+     * 输出参数。已读取的数据长度，单位为Byte，读取完成时填写。
+     */
+    int64_t bytesRead;
+
+    /**
+     * 输出参数。读取结果，读取完成时填写。0表示成功，-1表示失败，可能原因是文件不存在或偏移位置超出文件范围。
+     */
+    int result;
+} RawFileReadRequest;
+
+/**
+ * @brief RawFileReadBatch表示一批异步rawfile读取。通过{@link OH_ResourceManager_ReadRawFilesAsync}获取，使用完后须
+ * 通过{@link OH_ResourceManager_ReleaseRawFileReadBatch}释放。
+ *
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef struct RawFileReadBatch RawFileReadBatch;
+
+/**
+ * @brief 批量读取中的一次读取完成时调用的回调函数。
+ *
+ * @param request 输入参数。指向已完成读取的指针，其bytesRead和result已填写。
+ * @param userData 输入参数。传给{@link OH_ResourceManager_ReadRawFilesAsync}的用户数据指针。
+ * @since 26.1.0
+ * @version 1.0
+ */
+typedef void (*OH_ResourceManager_OnRawFileRead)(RawFileReadRequest *request, void *userData);
+
+/**
+ * @brief 提交一批rawfile读取，不等待读取完成即返回。读取按其在HAP中的位置排序，相邻的读取被合并，并在后台线程上并行
+ * 执行，启动时比逐个打开并读取文件快得多。
+ *
+ * @param mgr 输入参数。指向NativeResourceManager对象的指针。
+ * @param requests 输入参数。读取数组指针，在批量读取释放前须保持有效。
+ * @param count 输入参数。数组中的读取个数。
+ * @param callback 输入参数。每次读取完成时在后台线程上调用的回调函数，调用顺序不固定。可以为NULL。
+ * @param userData 输入参数。传给回调的用户数据指针，可以为NULL。
+ * @return 返回指向RawFileReadBatch对象的指针。若调用失败或mgr、requests为空，则返回NULL。使用完后须调用{@link OH_ResourceManager_ReleaseRawFileReadBatch}释放。
+ * @see {@link OH_ResourceManager_WaitRawFileReadBatch}
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileReadBatch *OH_ResourceManager_ReadRawFilesAsync(const NativeResourceManager *mgr,
+    RawFileReadRequest *requests, uint32_t count, OH_ResourceManager_OnRawFileRead callback, void *userData);
+
+/**
+ * @brief 等待批量读取中的所有读取完成。
+ *
+ * @param batch 输入参数。指向RawFileReadBatch对象的指针，通过{@link OH_ResourceManager_ReadRawFilesAsync}获取。
+ * @param timeoutMs 输入参数。最长等待时间，单位为毫秒。取值为-1表示一直等待。
+ * @return 返回true表示所有读取已完成，返回false表示等待超时或batch为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+bool OH_ResourceManager_WaitRawFileReadBatch(RawFileReadBatch *batch, int32_t timeoutMs);
+
+/**
+ * @brief 释放一批rawfile读取。尚未开始的读取被取消且不调用其回调，正在执行的读取完成后该函数才返回。
+ *
+ * @param batch 输入参数。指向RawFileReadBatch对象的指针，通过{@link OH_ResourceManager_ReadRawFilesAsync}获取。释放后该指针失效。
+ * @since 26.1.0
+ * @version 1.0
+ */
+void OH_ResourceManager_ReleaseRawFileReadBatch(RawFileReadBatch *batch);
+
+/**
+ * @brief 异步将rawfile文件加载到页缓存而不拷贝，使后续对这些文件的读取或映射无需等待I/O。文件按其在HAP中的位置顺序加载。
+ *
+ * @param mgr 输入参数。指向NativeResourceManager对象的指针。
+ * @param fileNames 输入参数。相对于rawfile根目录的文件路径数组指针。
+ * @param count 输入参数。数组中的路径个数。
+ * @return 返回true表示预取已提交，返回false表示mgr或fileNames为空。
+ * @since 26.1.0
+ * @version 1.0
+ */
+bool OH_ResourceManager_PrefetchRawFiles(const NativeResourceManager *mgr, const char *const *fileNames,
+    uint32_t count);
+
+/**
+ * @brief 为rawfile目录下的所有路径创建哈希索引快照。每个HAP只构建一次快照，进程内后续调用共享该快照。系统中存在该HAP
+ * 的预构建索引时，直接通过内存映射加载，无需构建。
+ *
+ * @param mgr 输入参数。指向NativeResourceManager对象的指针。
+ * @return 返回指向RawFileIndex对象的指针。若调用失败或mgr为空，则返回NULL。使用完后须调用{@link OH_ResourceManager_ReleaseRawFileIndex}释放。
+ * @see {@link OH_ResourceManager_InitNativeResourceManager}
+ * @see {@link OH_ResourceManager_ReleaseRawFileIndex}
+ * @since 26.1.0
+ * @version 1.0
+ */
+RawFileIndex *OH_ResourceManager_CreateRawFileIndex(const NativeResourceManager *mgr);
+
 #ifdef __cplusplus
 };
 #endif
@@ -809,6 +809,50 @@ ResourceManager_ErrorCode OH_ResourceManager_AddResource(const NativeResourceMan
  * @since 12
  */
 ResourceManager_ErrorCode OH_ResourceManager_RemoveResource(const NativeResourceManager *mgr, const char *path);
+
+/**
+ * @brief 一次性按当前配置解析多个资源。整批资源只匹配一次配置限定词，而不是每个资源匹配一次，所有字符串打包到一次内存
+ * 分配中。
+ * <br>单个资源解析失败不影响其他资源，需检查每个条目的errorCode。
+ *
+ * @param mgr 输入参数。指向NativeResourceManager对象的指针，此指针通过{@link OH_ResourceManager_InitNativeResourceManager}函数获取。
+ * @param items 输入输出参数。条目数组指针。每个条目的resId和type为输入，errorCode和value为输出。
+ * @param count 输入参数。数组中的条目个数。
+ * @param stringPool 输出参数。存放该批所有字符串值的内存，由malloc()分配，使用完后需通过free()释放。该批没有字符串值时置为NULL。
+ * @return 返回错误码。
+ *     <br>返回SUCCESS，表示成功，每个资源的结果通过其errorCode返回。
+ *     <br>返回ERROR_CODE_INVALID_INPUT_PARAMETER，表示输入参数无效。可能的原因：1.参数类型不正确；2.参数验证失败。
+ *     <br>返回ERROR_CODE_OUT_OF_MEMORY，表示内存溢出。
+ * @since 26.1.0
+ */
+ResourceManager_ErrorCode OH_ResourceManager_ResolveBatch(const NativeResourceManager *mgr,
+    ResourceManager_BatchItem *items, uint32_t count, char **stringPool);
+
+/**
+ * @brief 设置资源查找缓存的容量。缓存以资源ID和配置为键保存最近解析的资源值，满时淘汰最久未使用的值。缓存同时服务于
+ * {@link OH_ResourceManager_ResolveBatch}以及{@link OH_ResourceManager_GetString}、{@link OH_ResourceManager_GetColor}等
+ * 获取接口，在配置变化或添加、移除资源时失效。
+ *
+ * @param mgr 输入参数。指向NativeResourceManager对象的指针，此指针通过{@link OH_ResourceManager_InitNativeResourceManager}函数获取。
+ * @param capacity 输入参数。缓存的资源值个数上限。取值为0表示关闭缓存。默认值为0。
+ * @return 返回错误码。
+ *     <br>返回SUCCESS，表示成功。
+ *     <br>返回ERROR_CODE_INVALID_INPUT_PARAMETER，表示输入参数无效。可能的原因：1.参数类型不正确；2.参数验证失败。
+ * @since 26.1.0
+ */
+ResourceManager_ErrorCode OH_ResourceManager_SetCacheCapacity(const NativeResourceManager *mgr, uint32_t capacity);
+
+/**
+ * @brief 清空资源查找缓存。
+ *
+ * @param mgr 输入参数。指向NativeResourceManager对象的指针，此指针通过{@link OH_ResourceManager_InitNativeResourceManager}函数获取。
+ * @return 返回错误码。
+ *     <br>返回SUCCESS，表示成功。
+ *     <br>返回ERROR_CODE_INVALID_INPUT_PARAMETER，表示输入参数无效。可能的原因：1.参数类型不正确；2.参数验证失败。
+ * @since 26.1.0
+ */
+ResourceManager_ErrorCode OH_ResourceManager_ClearCache(const NativeResourceManager *mgr);
+
 #ifdef __cplusplus
 };
 #endif
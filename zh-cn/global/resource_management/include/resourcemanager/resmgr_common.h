@@ -41,6 +41,7 @@
 #define GLOBAL_RESMGR_COMMON_H
 
 # include <stdint.h>
+# include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -245,6 +246,80 @@ typedef struct ResourceManager_Configuration {
      */
     uint32_t reserved[20];
 } ResourceManager_Configuration;
+
+/**
+ * @brief {@link OH_ResourceManager_ResolveBatch}可解析的资源值类型。
+ *
+ * @since 26.1.0
+ */
+typedef enum ResourceManager_ValueType {
+    /**
+     * 字符串资源，按不带格式化参数的{@link OH_ResourceManager_GetString}方式解析。
+     */
+    VALUE_TYPE_STRING = 0,
+    /**
+     * 颜色资源，按{@link OH_ResourceManager_GetColor}方式解析。
+     */
+    VALUE_TYPE_COLOR = 1,
+    /**
+     * 整型资源，按{@link OH_ResourceManager_GetInt}方式解析。
+     */
+    VALUE_TYPE_INT = 2,
+    /**
+     * 浮点型资源，按{@link OH_ResourceManager_GetFloat}方式解析。
+     */
+    VALUE_TYPE_FLOAT = 3,
+    /**
+     * 布尔型资源，按{@link OH_ResourceManager_GetBool}方式解析。
+     */
+    VALUE_TYPE_BOOL = 4,
+} ResourceManager_ValueType;
+
+/**
+ * @brief 批量解析中单个资源的结构体。
+ *
+ * @since 26.1.0
+ */
+typedef struct ResourceManager_BatchItem {
+    /**
+     * 输入。资源ID。
+     */
+    uint32_t resId;
+    /**
+     * 输入。资源值类型。
+     */
+    ResourceManager_ValueType type;
+    /**
+     * 输出。该资源的错误码，仅为SUCCESS时资源值有效。
+     */
+    ResourceManager_ErrorCode errorCode;
+    /**
+     * 输出。资源值，使用的成员取决于type。
+     */
+    union {
+        /**
+         * 字符串值，指向{@link OH_ResourceManager_ResolveBatch}返回的字符串池。
+         */
+        const char* stringValue;
+        /**
+         * 颜色值。
+         */
+        uint32_t colorValue;
+        /**
+         * 整型值。
+         */
+        int intValue;
+        /**
+         * 浮点型值。
+         */
+        float floatValue;
+        /**
+         * 布尔型值。
+         */
+        bool boolValue;
+    } value;
+} ResourceManager_BatchItem;
+
 #ifdef __cplusplus
 };
 #endif
@@ -862,6 +862,234 @@ typedef enum OH_HiAppEvent_FrameworkType {
  */
 int OH_HiAppEvent_ReportFrameworkMemAnomaly(
     enum OH_HiAppEvent_FrameworkType frameworkType, const char* frameworkVersion, const char* description);
+
+/**
+ * @brief 创建一个基于预分配内存区的参数列表对象。通过**OH_HiAppEvent_Add*Param**接口添加到该列表的参数存放在内存区
+ * 中，而不是逐个申请内存，内存区仅在耗尽时扩容。配合{@link OH_HiAppEvent_ResetParamList}，同一列表可用于多个事件，
+ * 无需反复释放和申请内存。注意：列表不再使用时，需要调用{@link OH_HiAppEvent_DestroyParamList}销毁。
+ *
+ * @param arenaSize 内存区初始大小，单位为字节。取值为**0**时使用默认值**4096**。
+ * @return 参数列表对象的指针；内存申请失败时返回**NULL**。
+ * @since 26.1.0
+ */
+ParamList OH_HiAppEvent_CreateParamListWithArena(uint32_t arenaSize);
+
+/**
+ * @brief 清空参数列表对象中的所有参数，以便填充下一个事件。对于由{@link OH_HiAppEvent_CreateParamListWithArena}
+ * 创建的列表，内存区会保留以便复用；对于其他列表，参数节点会被释放。
+ *
+ * @param list 参数列表对象的指针。
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} 操作成功。</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} 参数list为空。</li>
+ *         </ul>
+ *     具体可参考{@link HiAppEvent_ErrorCode}。
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_ResetParamList(ParamList list);
+
+/**
+ * @brief 批量打点中单个事件的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_EventRecord {
+    /* 事件领域。 */
+    const char* domain;
+    /* 事件名称。 */
+    const char* name;
+    /* 事件类型。 */
+    enum EventType type;
+    /* 事件参数列表。 */
+    ParamList list;
+} HiAppEvent_EventRecord;
+
+/**
+ * @brief 一次调用记录多个应用事件。每个事件按与{@link OH_HiAppEvent_Write}相同的规则校验，然后所有通过校验的事件以
+ * 紧凑的二进制格式编码，一并提交给事件文件和数据处理者，单次提交的开销按批次而非按事件计算。该接口返回后，参数列表即可
+ * 重置和复用。
+ *
+ * @param records 需要记录的事件数组，详见{@link HiAppEvent_EventRecord}。
+ * @param count **records**中的事件个数，取值范围为1~1000。
+ * @param results 包含**count**个元素的数组，用于接收每个事件的校验结果，取值与{@link OH_HiAppEvent_Write}的返回值
+ *     相同。不需要结果时可传入**NULL**。
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} 批次已提交。被拒绝或丢弃了非法参数后写入的事件可通过**results**查看。</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} 参数records为空或count超出范围。</li>
+ *         <li>{@link HIAPPEVENT_OPERATE_FAILED} 打点功能被关闭或批次提交失败。</li>
+ *         </ul>
+ *     具体可参考{@link HiAppEvent_ErrorCode}。
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_WriteBatch(const HiAppEvent_EventRecord* records, uint32_t count, int* results);
+
+/**
+ * @brief 列式事件批次中列的取值类型的枚举。
+ *
+ * @since 26.1.0
+ */
+typedef enum HiAppEvent_ColumnType {
+    /**
+     * 布尔值，存放在**bools**中。
+     */
+    HIAPPEVENT_COLUMN_BOOL = 0,
+
+    /**
+     * 任意位宽的整数值，存放在**ints**中。
+     */
+    HIAPPEVENT_COLUMN_INT64 = 1,
+
+    /**
+     * 任意位宽的浮点值，存放在**doubles**中。
+     */
+    HIAPPEVENT_COLUMN_DOUBLE = 2,
+
+    /**
+     * 字符串，存放在**strings**中。
+     */
+    HIAPPEVENT_COLUMN_STRING = 3,
+
+    /**
+     * 数组参数，以JSON数组形式存放在**strings**中。
+     */
+    HIAPPEVENT_COLUMN_ARRAY_JSON = 4
+} HiAppEvent_ColumnType;
+
+/**
+ * @brief 列式事件批次中的一列，即批次内所有事件某个参数的取值。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_Column {
+    /* 参数名称。 */
+    const char* name;
+    /* 列的取值类型。 */
+    HiAppEvent_ColumnType type;
+    /* 批次内每个事件是否携带该参数。所有事件都携带时为NULL。 */
+    const bool* present;
+    /* 列的取值，每个事件一个。读取的成员由type决定。 */
+    union {
+        const bool* bools;
+        const int64_t* ints;
+        const double* doubles;
+        const char* const* strings;
+    } values;
+} HiAppEvent_Column;
+
+/**
+ * @brief 领域、名称和类型相同的一批事件的列式结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_EventBatch {
+    /* 事件领域。 */
+    const char* domain;
+    /* 事件名称。 */
+    const char* name;
+    /* 事件类型。 */
+    enum EventType type;
+    /* 批次内的事件个数。 */
+    uint32_t rowCount;
+    /* 每个事件的写入时间，为自纪元以来的毫秒数。 */
+    const int64_t* timestamps;
+    /* 批次的参数列。 */
+    const HiAppEvent_Column* columns;
+    /* 参数列数组的长度。 */
+    uint32_t columnCount;
+} HiAppEvent_EventBatch;
+
+/**
+ * @brief 将列式事件批次传给调用者。注意：回调中指针所指对象的生命周期仅限于该回调函数内，如需缓存，请进行深拷贝。
+ *
+ * @param batches 事件批次数组。
+ * @param batchLen 事件批次数组的长度。
+ * @param arg 传入{@link OH_HiAppEvent_SetWatcherOnReceiveBatch}的自定义参数。
+ * @since 26.1.0
+ */
+typedef void (*OH_HiAppEvent_OnReceiveBatch)(const HiAppEvent_EventBatch* batches, uint32_t batchLen, void* arg);
+
+/**
+ * @brief 观察者投递指标的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiAppEvent_WatcherMetrics {
+    /* 已投递给观察者的事件数。 */
+    uint64_t delivered;
+    /* 因观察者缓冲区已满而丢弃的事件数。 */
+    uint64_t dropped;
+    /* 当前等待额度的事件数。 */
+    uint32_t buffered;
+    /* 观察者剩余的额度，单位为事件数。 */
+    uint32_t credit;
+    /* 事件从写入到投递的平均耗时，单位为微秒。 */
+    uint64_t avgLatencyUs;
+    /* 事件从写入到投递的最大耗时，单位为微秒。 */
+    uint64_t maxLatencyUs;
+} HiAppEvent_WatcherMetrics;
+
+/**
+ * @brief 设置onReceiveBatch回调。观察者接收到的事件按领域、名称和类型分组，以带类型的列投递，不转换为JSON。设置该
+ * 回调后，观察者的{@link OH_HiAppEvent_OnReceive}回调不再被调用。
+ * <br>投递受额度控制：每投递一个事件消耗一个额度，观察者无额度时收到的事件会被缓存，直到调用
+ * {@link OH_HiAppEvent_GrantWatcherCredit}。首次授予额度之前，观察者的额度不受限制。
+ *
+ * @param watcher 指向观察者的指针（即{@link OH_HiAppEvent_CreateWatcher}返回的指针）。
+ * @param onReceiveBatch 回调函数的指针。
+ * @param arg 传给回调的自定义参数。
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} 操作成功。</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} 参数watcher或onReceiveBatch为空。</li>
+ *         </ul>
+ *     具体可参考{@link HiAppEvent_ErrorCode}。
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_SetWatcherOnReceiveBatch(HiAppEvent_Watcher* watcher, OH_HiAppEvent_OnReceiveBatch onReceiveBatch,
+    void* arg);
+
+/**
+ * @brief 向观察者授予投递额度。缓存的事件会在额度范围内立即投递。
+ *
+ * @param watcher 指向观察者的指针（即{@link OH_HiAppEvent_CreateWatcher}返回的指针）。
+ * @param events 允许投递的事件数，累加到剩余额度上。
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} 操作成功。</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} 参数watcher为空。</li>
+ *         </ul>
+ *     具体可参考{@link HiAppEvent_ErrorCode}。
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_GrantWatcherCredit(HiAppEvent_Watcher* watcher, uint32_t events);
+
+/**
+ * @brief 设置观察者无额度时最多缓存的事件数。缓冲区已满时，最早缓存的事件被丢弃，
+ * 并计入{@link HiAppEvent_WatcherMetrics}。
+ *
+ * @param watcher 指向观察者的指针（即{@link OH_HiAppEvent_CreateWatcher}返回的指针）。
+ * @param maxEvents 最多缓存的事件数，取值范围为1~100000，默认值为**10000**。
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} 操作成功。</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} 参数watcher为空或maxEvents超出范围。</li>
+ *         </ul>
+ *     具体可参考{@link HiAppEvent_ErrorCode}。
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_SetWatcherBufferLimit(HiAppEvent_Watcher* watcher, uint32_t maxEvents);
+
+/**
+ * @brief 获取观察者的投递指标。
+ *
+ * @param watcher 指向观察者的指针（即{@link OH_HiAppEvent_CreateWatcher}返回的指针）。
+ * @param metrics 指向{@link HiAppEvent_WatcherMetrics}的指针，用于接收指标。
+ * @return <ul>
+ *         <li>{@link HIAPPEVENT_SUCCESS} 操作成功。</li>
+ *         <li>{@link HIAPPEVENT_INVALID_PARAM_VALUE} 参数watcher或metrics为空。</li>
+ *         </ul>
+ *     具体可参考{@link HiAppEvent_ErrorCode}。
+ * @since 26.1.0
+ */
+int OH_HiAppEvent_GetWatcherMetrics(HiAppEvent_Watcher* watcher, HiAppEvent_WatcherMetrics* metrics);
+
 #ifdef __cplusplus
 }
 #endif
@@ -398,6 +398,176 @@ void* OH_HiCollie_SetFreezeCallback(OH_HiCollie_FreezeCallback callback);
  */
 HiCollie_ErrorCode OH_HiCollie_AssociateProcessReport(bool isFreezeEvent);
 
+/**
+ * @brief 时延直方图检测的参数定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiCollie_LatencyHistogramParam {
+    /**
+     * 任务耗时超过该值（单位为ms）时上报卡顿，取值范围为16~6000。
+     *
+     * @since 26.1.0
+     */
+    uint32_t jankThresholdMs;
+    /**
+     * 按完整精度记录的最大任务耗时，单位为ms。超过该值的任务记录在最后一个桶中。取值为**0**时使用默认值**60000**。
+     *
+     * @since 26.1.0
+     */
+    uint32_t maxTrackableMs;
+    /**
+     * 每个记录耗时保留的十进制有效位数，取值范围为1~3。若超出范围，则使用默认值**2**，此时百分位的相对误差不超过1%。
+     *
+     * @since 26.1.0
+     */
+    uint32_t significantDigits;
+    /**
+     * 是否采集耗时超过**jankThresholdMs**的任务的调用栈。调用栈在任务仍在执行时通过HiDebug轻量级采样获取。
+     *
+     * @since 26.1.0
+     */
+    bool captureBacktrace;
+    /**
+     * 扩展参数以供将来使用，需设置为**0**。
+     *
+     * @since 26.1.0
+     */
+    int reserved;
+} HiCollie_LatencyHistogramParam;
+
+/**
+ * @brief 时延直方图检测发现的卡顿信息定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiCollie_JankInfo {
+    /**
+     * 传给任务开始函数的事件名称。
+     *
+     * @since 26.1.0
+     */
+    const char* eventName;
+    /**
+     * 任务耗时，单位为微秒。
+     *
+     * @since 26.1.0
+     */
+    uint64_t durationUs;
+    /**
+     * 任务的采样调用栈。未采集调用栈时为NULL。
+     *
+     * @since 26.1.0
+     */
+    const char* backtrace;
+} HiCollie_JankInfo;
+
+/**
+ * @brief 时延直方图检测每次发现卡顿时在HiCollie线程上调用的回调。info仅在该回调执行期间有效。
+ *
+ * @param info 卡顿信息，详见{@link HiCollie_JankInfo}。
+ * @since 26.1.0
+ */
+typedef void (*OH_HiCollie_JankCallback)(const HiCollie_JankInfo* info);
+
+/**
+ * @brief 时延直方图检测所记录任务的时延汇总定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiCollie_LatencySummary {
+    /**
+     * 记录的任务数。
+     *
+     * @since 26.1.0
+     */
+    uint64_t count;
+    /**
+     * 上报为卡顿的任务数。
+     *
+     * @since 26.1.0
+     */
+    uint64_t jankCount;
+    /**
+     * 任务耗时的中位数，单位为微秒。
+     *
+     * @since 26.1.0
+     */
+    uint64_t p50Us;
+    /**
+     * 任务耗时的第99百分位，单位为微秒。
+     *
+     * @since 26.1.0
+     */
+    uint64_t p99Us;
+    /**
+     * 任务耗时的第99.9百分位，单位为微秒。
+     *
+     * @since 26.1.0
+     */
+    uint64_t p999Us;
+    /**
+     * 最大任务耗时，单位为微秒。
+     *
+     * @since 26.1.0
+     */
+    uint64_t maxUs;
+} HiCollie_LatencySummary;
+
+/**
+ * @brief 为调用线程注册时延直方图检测。与{@link OH_HiCollie_Init_JankDetection}类似，提供两个插桩函数，分别在线程
+ * 每个任务执行前后调用。除上报卡顿外，每个任务的耗时都记录在相对误差有界的直方图中，无需保存单个样本即可随时查询百分位。
+ * <br>与{@link OH_HiCollie_Init_JankDetection}不同，该函数面向主线程，可在主线程中调用，也可在业务线程中调用。每个进程只有
+ * 一个时延直方图，绑定到第一个成功调用该函数的线程。在同一线程中再次调用会更新param和callback并保留已记录的耗时；在其他线程
+ * 中调用则失败。插桩函数在绑定线程以外的线程中调用时不记录任何数据。
+ *
+ * @param beginFunc 每个任务执行前调用的函数。
+ * @param endFunc 每个任务执行后调用的函数。
+ * @param param 检测参数，详见{@link HiCollie_LatencyHistogramParam}。
+ * @param callback 每次卡顿时调用的回调。仅需统计卡顿次数时可传入NULL。
+ * @return {@link HICOLLIE_SUCCESS} 0 - 成功。
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - beginFunc或endFunc为空，或参数超出范围。
+ * {@link HICOLLIE_WRONG_THREAD_CONTEXT} 29800001 - 调用线程错误。该进程已在其他线程上初始化该检测。
+ * 具体可参考{@link HiCollie_ErrorCode}。
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_Init_LatencyHistogram(OH_HiCollie_BeginFunc* beginFunc,
+    OH_HiCollie_EndFunc* endFunc, HiCollie_LatencyHistogramParam param, OH_HiCollie_JankCallback callback);
+
+/**
+ * @brief 获取时延直方图检测所记录任务耗时的某个百分位。每个进程只有一个直方图，因此可在任意线程中调用该函数。
+ *
+ * @param percentile 要查询的百分位，取值范围为0~100，例如**99.9**。
+ * @param valueUs 指向该百分位任务耗时的指针，单位为微秒。
+ * @return {@link HICOLLIE_SUCCESS} 0 - 成功。
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - percentile超出范围、valueUs为空或检测未初始化。
+ * 具体可参考{@link HiCollie_ErrorCode}。
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_GetLatencyPercentile(double percentile, uint64_t* valueUs);
+
+/**
+ * @brief 获取时延直方图检测所记录任务的时延汇总。每个进程只有一个直方图，因此可在任意线程中调用该函数。
+ *
+ * @param summary 指向{@link HiCollie_LatencySummary}的指针。
+ * @return {@link HICOLLIE_SUCCESS} 0 - 成功。
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - summary为空或检测未初始化。
+ * 具体可参考{@link HiCollie_ErrorCode}。
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_GetLatencySummary(HiCollie_LatencySummary* summary);
+
+/**
+ * @brief 清空时延直方图检测的直方图，例如在一个度量窗口开始时调用。每个进程只有一个直方图，因此可在任意线程中调用该函数。
+ * 线程绑定关系保持不变。
+ *
+ * @return {@link HICOLLIE_SUCCESS} 0 - 成功。
+ * {@link HICOLLIE_INVALID_ARGUMENT} 401 - 检测未初始化。
+ * 具体可参考{@link HiCollie_ErrorCode}。
+ * @since 26.1.0
+ */
+HiCollie_ErrorCode OH_HiCollie_ResetLatencyHistogram(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -579,6 +579,256 @@ HiDebug_ErrorCode OH_HiDebug_SetMaxDurationSec(OH_HiDebug_ProfilerOptions *opts,
 HiDebug_ErrorCode OH_HiDebug_StartProfilerWithOptions(OH_HiDebug_ResourceType type,
     OH_HiDebug_ProfilerOptions *opts, OH_HiDebug_ProfilingCallback callback);
 
+/**
+ * @brief 创建当前进程的持续CPU采样器。采样器以低频率采样指定线程，基于fp回栈，并在内存中按调用栈聚合采样结果，
+ * 可在生产环境中常驻运行，并在需要时导出采样数据。
+ *
+ * @param config [in] 指向{@link HiDebug_CpuProfilerConfig}的指针。传入NULL时使用默认配置。
+ * @return 创建的采样器指针。创建失败时返回NULL。
+ * @release hidebug/OH_HiDebug_DestroyCpuProfiler {return}
+ * @since 26.1.0
+ */
+HiDebug_CpuProfiler *OH_HiDebug_CreateCpuProfiler(const HiDebug_CpuProfilerConfig *config);
+
+/**
+ * @brief 销毁持续CPU采样器。若采样器正在运行，则先停止采样，并丢弃已聚合的采样数据。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateCpuProfiler}创建的采样器。
+ * @since 26.1.0
+ */
+void OH_HiDebug_DestroyCpuProfiler(HiDebug_CpuProfiler *profiler);
+
+/**
+ * @brief 启动持续CPU采样器。采样结果持续聚合，直到调用{@link OH_HiDebug_StopCpuProfiler}。同一进程同一时间只能运行
+ * 一个持续CPU采样器。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateCpuProfiler}创建的采样器。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针。</li>
+ *     <li>{@link HIDEBUG_NOT_SUPPORTED} 不支持持续CPU采样。</li>
+ *     <li>{@link HIDEBUG_UNDER_SAMPLING} 已有其他持续CPU采样器正在运行。</li>
+ *     <li>{@link HIDEBUG_RESOURCE_UNAVAILABLE} 采样资源不足。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StartCpuProfiler(HiDebug_CpuProfiler *profiler);
+
+/**
+ * @brief 停止持续CPU采样器。已聚合的采样数据会保留，仍可导出。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateCpuProfiler}创建的采样器。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针或未在运行。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StopCpuProfiler(HiDebug_CpuProfiler *profiler);
+
+/**
+ * @brief 导出持续CPU采样器已聚合的采样数据。栈帧在导出时才进行符号解析，采样路径不做符号查找。该接口可在采样器运行
+ * 期间调用。注意：该接口涉及I/O操作和符号解析，建议不要在主线程中调用。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateCpuProfiler}创建的采样器。
+ * @param format [in] 导出格式，详见{@link HiDebug_CpuProfileFormat}。
+ * @param fd [in] 写入采样数据的可写文件描述符。该接口不会关闭该fd。
+ * @param reset [in] 导出后是否清空已聚合的采样数据，使下次导出仅包含此后采集的数据。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针，或format、fd无效。</li>
+ *     <li>{@link HIDEBUG_TRACE_ABNORMAL} 写入采样数据失败。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ExportCpuProfile(HiDebug_CpuProfiler *profiler, HiDebug_CpuProfileFormat format,
+    int32_t fd, bool reset);
+
+/**
+ * @brief 获取持续CPU采样器的统计信息。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateCpuProfiler}创建的采样器。
+ * @param stats [out] 指向{@link HiDebug_CpuProfilerStats}的指针。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler或stats是一个空指针。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_GetCpuProfilerStats(HiDebug_CpuProfiler *profiler, HiDebug_CpuProfilerStats *stats);
+
+/**
+ * @brief 创建当前进程的采样堆内存分析器。启动后，分析器通过MallocDispatch表接管内存操作函数，按分配字节数采样，
+ * 基于fp回栈获取调用栈，并按调用栈聚合存活字节数和累计字节数。
+ *
+ * @param config [in] 指向{@link HiDebug_HeapProfilerConfig}的指针。传入NULL时使用默认配置。
+ * @return 创建的分析器指针。创建失败时返回NULL。
+ * @release hidebug/OH_HiDebug_DestroyHeapProfiler {return}
+ * @since 26.1.0
+ */
+HiDebug_HeapProfiler *OH_HiDebug_CreateHeapProfiler(const HiDebug_HeapProfilerConfig *config);
+
+/**
+ * @brief 销毁采样堆内存分析器。若分析器正在运行，则先停止，并丢弃已聚合的采样数据。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @since 26.1.0
+ */
+void OH_HiDebug_DestroyHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief 安装分析器的MallocDispatch表以启动采样堆内存分析器。同一进程同一时间只能运行一个采样堆内存分析器，且不能与
+ * 通过{@link OH_HiDebug_SetMallocDispatchTable}设置的自定义表同时使用。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针。</li>
+ *     <li>{@link HIDEBUG_NOT_SUPPORTED} 不支持堆内存分析。</li>
+ *     <li>{@link HIDEBUG_UNDER_SAMPLING} 已有其他堆内存分析器或自定义MallocDispatch表正在使用。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StartHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief 停止采样堆内存分析器，并恢复基础C库的MallocDispatch表。已聚合的采样数据会保留，仍可查询或导出。此后被采样
+ * 内存块的释放不再被跟踪，存活字节数保持为停止时的值。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针或未在运行。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_StopHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief 清空采样堆内存分析器聚合的累计字节数和累计次数。存活字节数会保留，因为其对应的内存块仍处于已分配状态。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ResetHeapProfiler(HiDebug_HeapProfiler *profiler);
+
+/**
+ * @brief 获取采样堆内存分析器的统计信息。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @param stats [out] 指向{@link HiDebug_HeapProfilerStats}的指针。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler或stats是一个空指针。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_GetHeapProfilerStats(HiDebug_HeapProfiler *profiler, HiDebug_HeapProfilerStats *stats);
+
+/**
+ * @brief 遍历采样堆内存分析器记录的分配调用栈，例如用于在测试中断言内存分配是否劣化。回调中的内存分配不会被采样。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @param callback [in] 每个分配调用栈调用一次的回调。
+ * @param arg [in] 传给回调的自定义参数。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler或callback是一个空指针。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ForEachHeapProfileEntry(HiDebug_HeapProfiler *profiler,
+    OH_HiDebug_HeapProfileEntryCallback callback, void *arg);
+
+/**
+ * @brief 以gzip压缩的pprof格式导出采样堆内存分析器已聚合的采样数据，包含alloc_space、alloc_objects、inuse_space和
+ * inuse_objects四种采样类型。注意：该接口涉及I/O操作和符号解析，建议不要在主线程中调用。
+ *
+ * @param profiler [in] 由{@link OH_HiDebug_CreateHeapProfiler}创建的分析器。
+ * @param fd [in] 写入采样数据的可写文件描述符。该接口不会关闭该fd。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} profiler是一个空指针或fd无效。</li>
+ *     <li>{@link HIDEBUG_TRACE_ABNORMAL} 写入采样数据失败。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_ExportHeapProfile(HiDebug_HeapProfiler *profiler, int32_t fd);
+
+/**
+ * @brief 订阅当前进程的内存统计信息。订阅字段按配置的间隔在共享的后台线程上采样，仅在至少一个字段发生变化时调用回调。
+ * 同一进程最多同时存在8个订阅。
+ *
+ * @param config [in] 指向{@link HiDebug_MemorySubscribeConfig}的指针。
+ * @param callback [in] 携带变化字段的回调，详见{@link OH_HiDebug_MemorySubscribeCallback}。
+ * @param arg [in] 传给回调的自定义参数。
+ * @param subscriptionId [out] 订阅ID，用于取消订阅或读取最近一次采样。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} config、callback或subscriptionId是一个空指针，或未订阅任何字段。</li>
+ *     <li>{@link HIDEBUG_RESOURCE_UNAVAILABLE} 订阅数量已达上限。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_SubscribeMemory(const HiDebug_MemorySubscribeConfig *config,
+    OH_HiDebug_MemorySubscribeCallback callback, void *arg, uint32_t *subscriptionId);
+
+/**
+ * @brief 取消内存订阅。该接口返回后，该订阅的回调不会再被调用。不能在同一订阅的回调中调用该接口。
+ *
+ * @param subscriptionId [in] 由{@link OH_HiDebug_SubscribeMemory}获取的订阅ID。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} 订阅不存在。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_UnsubscribeMemory(uint32_t subscriptionId);
+
+/**
+ * @brief 获取内存订阅最近一次投递的采样。该接口仅拷贝缓存的采样，不读取任何/proc节点，可在任意线程低开销轮询。结果与
+ * 最近一次传给回调的snapshot相同，其**changedFields**与回调中的含义一致，即相对再前一次投递发生变化的字段。
+ *
+ * @param subscriptionId [in] 由{@link OH_HiDebug_SubscribeMemory}获取的订阅ID。
+ * @param snapshot [out] 指向{@link HiDebug_MemorySnapshot}的指针。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} snapshot是一个空指针或订阅不存在。</li>
+ *     <li>{@link HIDEBUG_RESOURCE_UNAVAILABLE} 尚未投递任何采样。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_GetLatestMemorySnapshot(uint32_t subscriptionId, HiDebug_MemorySnapshot *snapshot);
+
+/**
+ * @brief 创建当前进程的线程CPU跟踪器。与{@link OH_HiDebug_GetAppThreadCpuUsage}不同，跟踪器保持每个线程的stat节点
+ * 处于打开状态，更新时仅重新读取这些节点，且最多每**rescanIntervalMs**重新扫描一次进程线程列表以发现新线程。线程的
+ * 节点无法读取时，视为线程已退出并移除。
+ *
+ * @param rescanIntervalMs [in] 两次扫描线程列表之间的最小间隔，单位为ms。取值为**0**时每次更新都扫描线程列表。
+ * @return 创建的跟踪器指针。创建失败时返回NULL。
+ * @release hidebug/OH_HiDebug_DestroyThreadCpuTracker {return}
+ * @since 26.1.0
+ */
+HiDebug_ThreadCpuTracker *OH_HiDebug_CreateThreadCpuTracker(uint32_t rescanIntervalMs);
+
+/**
+ * @brief 销毁线程CPU跟踪器，并关闭其持有的文件描述符。
+ *
+ * @param tracker [in] 由{@link OH_HiDebug_CreateThreadCpuTracker}创建的跟踪器。
+ * @since 26.1.0
+ */
+void OH_HiDebug_DestroyThreadCpuTracker(HiDebug_ThreadCpuTracker *tracker);
+
+/**
+ * @brief 更新线程CPU跟踪器，并将自上次更新以来每个线程的CPU使用率写入调用者提供的数组。不重新扫描线程列表的更新不申请
+ * 内存；按**rescanIntervalMs**重新扫描线程列表的更新可能为新发现的线程申请内存。创建后的首次更新仅记录基线，不上报任何
+ * 线程。同一跟踪器不能在多个线程中同时更新。
+ *
+ * @param tracker [in] 由{@link OH_HiDebug_CreateThreadCpuTracker}创建的跟踪器。
+ * @param samples [out] 写入各线程结果的数组。
+ * @param capacity [in] **samples**中的元素个数。
+ * @param count [out] 跟踪的线程数。若该值大于**capacity**，则仅写入前**capacity**个线程，调用者可使用更大的数组重试。
+ * @return 返回码。
+ *     <ul><li>{@link HIDEBUG_SUCCESS} 成功。</li>
+ *     <li>{@link HIDEBUG_INVALID_ARGUMENT} tracker或count是一个空指针，或capacity不为0时samples是一个空指针。</li>
+ *     <li>{@link HIDEBUG_TRACE_ABNORMAL} 读取线程信息失败。</li></ul>
+ * @since 26.1.0
+ */
+HiDebug_ErrorCode OH_HiDebug_UpdateThreadCpuTracker(HiDebug_ThreadCpuTracker *tracker,
+    HiDebug_ThreadCpuSample *samples, uint32_t capacity, uint32_t *count);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -41,6 +41,7 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <unistd.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -774,6 +775,369 @@ typedef enum OH_HiDebug_MemListenerType {
     OH_HIDEBUG_DUMP_SNAPSHOT = 2
 } OH_HiDebug_MemListenerType;
 
+/**
+ * @brief 持续CPU采样器采样线程范围的枚举。
+ *
+ * @since 26.1.0
+ */
+typedef enum HiDebug_CpuProfilerThreadMode {
+    /**
+     * 采样当前进程的所有线程。
+     */
+    HIDEBUG_CPU_PROFILER_ALL_THREADS = 0,
+
+    /**
+     * 仅采样当前进程的主线程。
+     */
+    HIDEBUG_CPU_PROFILER_MAIN_THREAD = 1
+} HiDebug_CpuProfilerThreadMode;
+
+/**
+ * @brief 持续CPU采样器导出格式的枚举。
+ *
+ * @since 26.1.0
+ */
+typedef enum HiDebug_CpuProfileFormat {
+    /**
+     * 折叠栈格式，每个不同的调用栈占一行，栈帧之间以分号分隔，行尾为采样次数，可直接用于生成火焰图。
+     */
+    HIDEBUG_CPU_PROFILE_FORMAT_FOLDED = 0,
+
+    /**
+     * gzip压缩的pprof protobuf格式。
+     */
+    HIDEBUG_CPU_PROFILE_FORMAT_PPROF = 1
+} HiDebug_CpuProfileFormat;
+
+/**
+ * @brief 持续CPU采样器配置的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_CpuProfilerConfig {
+    /**
+     * 采样频率，单位为Hz，取值范围为1~100。若超出范围，则使用默认值**10**。
+     */
+    uint32_t frequency;
+
+    /**
+     * 单次采样记录的最大栈帧数，取值范围为1~128。若超出范围，则使用默认值**64**。
+     */
+    uint32_t maxStackDepth;
+
+    /**
+     * 采样线程范围，详见{@link HiDebug_CpuProfilerThreadMode}。
+     */
+    HiDebug_CpuProfilerThreadMode threadMode;
+
+    /**
+     * 内存中保留的不同调用栈的最大数量。达到上限后，调用栈尚未被记录的采样计为丢弃。取值为**0**时使用默认值**4096**。
+     */
+    uint32_t maxUniqueStacks;
+} HiDebug_CpuProfilerConfig;
+
+/**
+ * @brief 持续CPU采样器统计信息的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_CpuProfilerStats {
+    /**
+     * 自采样器启动或上次重置以来聚合的采样次数。
+     */
+    uint64_t samples;
+
+    /**
+     * 因调用栈表已满或线程无法回栈而丢弃的采样次数。
+     */
+    uint64_t droppedSamples;
+
+    /**
+     * 当前内存中保留的不同调用栈数量。
+     */
+    uint32_t uniqueStacks;
+
+    /**
+     * 采样与聚合消耗的CPU时间，单位为微秒。
+     */
+    uint64_t overheadUs;
+} HiDebug_CpuProfilerStats;
+
+/**
+ * @brief 持续CPU采样器对象定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_CpuProfiler HiDebug_CpuProfiler;
+
+/**
+ * @brief 采样堆内存分析器配置的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfilerConfig {
+    /**
+     * 平均采样间隔，单位为字节。按分配字节数以泊松过程进行采样，大小为s的单次分配被采样的概率为
+     * 1 - e^(-s / sampleIntervalBytes)。远小于该间隔的分配被采样的概率约为s / sampleIntervalBytes，大小等于该间隔的分配
+     * 约为63%，更大的分配趋近于100%。取值为**0**时使用默认值**524288**。
+     */
+    uint32_t sampleIntervalBytes;
+
+    /**
+     * 每次被采样的分配记录的最大栈帧数，取值范围为1~128。若超出范围，则使用默认值**64**。
+     */
+    uint32_t maxStackDepth;
+
+    /**
+     * 内存中保留的不同分配调用栈的最大数量。达到上限后，调用栈尚未被记录的采样计为丢弃。取值为**0**时使用默认值
+     * **4096**。
+     */
+    uint32_t maxUniqueStacks;
+} HiDebug_HeapProfilerConfig;
+
+/**
+ * @brief 采样堆内存分析器按单个调用栈聚合的分配统计的结构体定义。字节数和次数均为按采样比例换算的估算值。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfileEntry {
+    /**
+     * 分配调用栈的PC地址，最内层栈帧在前。地址可传入{@link OH_HiDebug_SymbolicAddress}进行解析。
+     */
+    void* const* pcs;
+
+    /**
+     * **pcs**中的元素个数。
+     */
+    uint32_t depth;
+
+    /**
+     * 该调用栈已分配且尚未释放的估算字节数。
+     */
+    uint64_t liveBytes;
+
+    /**
+     * 该调用栈已分配且尚未释放的估算分配次数。
+     */
+    uint64_t liveCount;
+
+    /**
+     * 自分析器启动或上次重置以来该调用栈分配的估算字节数。
+     */
+    uint64_t totalBytes;
+
+    /**
+     * 自分析器启动或上次重置以来该调用栈的估算分配次数。
+     */
+    uint64_t totalCount;
+} HiDebug_HeapProfileEntry;
+
+/**
+ * @brief 采样堆内存分析器统计信息的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfilerStats {
+    /**
+     * 被采样的分配次数。
+     */
+    uint64_t sampledAllocations;
+
+    /**
+     * 因调用栈表已满而丢弃的采样次数。
+     */
+    uint64_t droppedSamples;
+
+    /**
+     * 当前内存中保留的不同分配调用栈数量。
+     */
+    uint32_t uniqueStacks;
+
+    /**
+     * 所有调用栈已分配且尚未释放的估算字节数之和。
+     */
+    uint64_t liveBytes;
+
+    /**
+     * 自分析器启动或上次重置以来所有调用栈分配的估算字节数之和。
+     */
+    uint64_t totalBytes;
+} HiDebug_HeapProfilerStats;
+
+/**
+ * @brief 采样堆内存分析器每个分配调用栈的遍历回调。entry仅在该回调执行期间有效。
+ *
+ * @param entry 单个调用栈的分配统计，详见{@link HiDebug_HeapProfileEntry}。
+ * @param arg 传入{@link OH_HiDebug_ForEachHeapProfileEntry}的自定义参数。
+ * @return 返回**true**继续遍历；返回**false**停止遍历。
+ * @since 26.1.0
+ */
+typedef bool (*OH_HiDebug_HeapProfileEntryCallback)(const HiDebug_HeapProfileEntry* entry, void* arg);
+
+/**
+ * @brief 采样堆内存分析器对象定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_HeapProfiler HiDebug_HeapProfiler;
+
+/**
+ * @brief 可订阅的内存字段的枚举，取值可按位或组合。
+ *
+ * @since 26.1.0
+ */
+typedef enum HiDebug_MemoryField {
+    /**
+     * 进程的实际使用物理内存（按比例分配共享库）。
+     */
+    HIDEBUG_MEMORY_FIELD_PSS = 1 << 0,
+
+    /**
+     * 进程的常驻物理内存。
+     */
+    HIDEBUG_MEMORY_FIELD_RSS = 1 << 1,
+
+    /**
+     * 进程被换出的内存。
+     */
+    HIDEBUG_MEMORY_FIELD_SWAP = 1 << 2,
+
+    /**
+     * 进程的图形内存，即{@link HiDebug_GraphicsMemorySummary}中各项之和。
+     */
+    HIDEBUG_MEMORY_FIELD_GRAPHICS = 1 << 3
+} HiDebug_MemoryField;
+
+/**
+ * @brief 内存订阅配置的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_MemorySubscribeConfig {
+    /**
+     * 采样间隔，单位为ms，取值范围为100~60000。若超出范围，则使用默认值**1000**。
+     */
+    uint32_t intervalMs;
+
+    /**
+     * 采样字段，为{@link HiDebug_MemoryField}取值的组合。取值为**0**时无效。
+     */
+    uint32_t fields;
+
+    /**
+     * 计算最小值、最大值和平均值所使用的最近采样次数。取值为**0**时使用默认值**60**。
+     */
+    uint32_t windowSize;
+
+    /**
+     * 字段被视为发生变化的最小变化量，单位为KB。取值为**0**时任何变化都会上报。
+     */
+    uint32_t changeThresholdKb;
+} HiDebug_MemorySubscribeConfig;
+
+/**
+ * @brief 单个内存字段在订阅窗口内统计值的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_MemoryFieldStats {
+    /**
+     * 最近一次采样值，单位为KB。
+     */
+    uint32_t current;
+
+    /**
+     * 窗口内最小值，单位为KB。
+     */
+    uint32_t min;
+
+    /**
+     * 窗口内最大值，单位为KB。
+     */
+    uint32_t max;
+
+    /**
+     * 窗口内平均值，单位为KB。
+     */
+    uint32_t avg;
+} HiDebug_MemoryFieldStats;
+
+/**
+ * @brief 向订阅者投递的内存采样的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_MemorySnapshot {
+    /**
+     * 采样时间，为系统启动以来的毫秒数。
+     */
+    uint64_t timestampMs;
+
+    /**
+     * 自上次投递以来取值发生变化的字段，为{@link HiDebug_MemoryField}取值的组合。只需读取这些字段，其余字段保持上次
+     * 投递时的值。
+     */
+    uint32_t changedFields;
+
+    /**
+     * PSS统计值。
+     */
+    HiDebug_MemoryFieldStats pss;
+
+    /**
+     * RSS统计值。
+     */
+    HiDebug_MemoryFieldStats rss;
+
+    /**
+     * swap统计值。
+     */
+    HiDebug_MemoryFieldStats swap;
+
+    /**
+     * 图形内存统计值。
+     */
+    HiDebug_MemoryFieldStats graphics;
+} HiDebug_MemorySnapshot;
+
+/**
+ * @brief 至少一个订阅的内存字段发生变化时，在采样线程上调用的回调。snapshot仅在该回调执行期间有效。
+ *
+ * @param snapshot 内存采样，详见{@link HiDebug_MemorySnapshot}。
+ * @param arg 传入{@link OH_HiDebug_SubscribeMemory}的自定义参数。
+ * @since 26.1.0
+ */
+typedef void (*OH_HiDebug_MemorySubscribeCallback)(const HiDebug_MemorySnapshot* snapshot, void* arg);
+
+/**
+ * @brief 线程CPU跟踪器计算得到的单个线程CPU使用率的结构体定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_ThreadCpuSample {
+    /**
+     * 线程ID。
+     */
+    uint32_t threadId;
+
+    /**
+     * 最近两次更新之间的线程CPU使用率，单位为百分比。
+     */
+    double cpuUsage;
+
+    /**
+     * 最近两次更新之间线程消耗的CPU时间，单位为微秒。
+     */
+    uint64_t cpuTimeUs;
+} HiDebug_ThreadCpuSample;
+
+/**
+ * @brief 线程CPU跟踪器对象定义。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiDebug_ThreadCpuTracker HiDebug_ThreadCpuTracker;
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -225,70 +225,122 @@ int OH_LOG_VPrint(LogType type, LogLevel level, unsigned int domain, const char
  */
 bool OH_LOG_IsLoggable(unsigned int domain, const char *tag, LogLevel level);
 
+/**
+ * @brief 当前进程可能输出的最低日志级别。
+ *
+ * 该值由HiLog维护，在系统日志级别、{@link OH_LOG_SetMinLogLevel}或{@link OH_LOG_SetLogLevel}变化时更新。该值是任意日志业务领域和
+ * 日志标签下可输出的最低级别，低于该级别的日志一定不会输出，不低于该级别的日志仍由{@link OH_LOG_Print}进行检查。
+ * 该变量由{@link OH_LOG_IsLevelEnabled}读取，不允许修改。该符号为弱符号，使用本头文件构建的应用在不提供该符号的系统上仍可运行。 \n
+ *
+ * @since 26.1.0
+ */
+extern const volatile int OH_LOG_LowestLevel __attribute__((weak));
+
+/**
+ * @brief 当前源文件编译保留的最低日志级别。
+ *
+ * 低于该级别的{@link OH_LOG_DEBUG}、{@link OH_LOG_INFO}、{@link OH_LOG_WARN}、{@link OH_LOG_ERROR}和{@link OH_LOG_FATAL}调用
+ * 在编译期被移除，其参数不会被求值。需要在包含本头文件前定义，例如<b>#define HILOG_MIN_LEVEL LOG_INFO</b>。
+ * 默认值为<b>LOG_DEBUG</b>，即保留所有级别。 \n
+ *
+ * @since 26.1.0
+ */
+#ifndef HILOG_MIN_LEVEL
+#define HILOG_MIN_LEVEL LOG_DEBUG
+#endif
+
+/**
+ * @brief 检查指定级别的日志是否可能输出，宏封装接口。
+ *
+ * 该检查先在编译期与{@link HILOG_MIN_LEVEL}比较，否则仅与{@link OH_LOG_LowestLevel}进行一次比较，不产生函数调用。
+ * 返回<b>true</b>并不保证该日志在所有日志业务领域和日志标签下都会输出，精确检查请使用{@link OH_LOG_IsLoggable}。 \n
+ *
+ * @param level 日志级别。
+ * @return 指定级别的日志不能输出时返回<b>false</b>；否则返回<b>true</b>。
+ * @since 26.1.0
+ */
+#define OH_LOG_IsLevelEnabled(level) \
+    ((level) >= HILOG_MIN_LEVEL && (&OH_LOG_LowestLevel == NULL || (int)(level) >= OH_LOG_LowestLevel))
+
 /**
  * @brief DEBUG级别写日志，宏封装接口。
  *
  * 在调用此函数之前，需要先定义LOG_DOMAIN和LOG_TAG。通常，一般在源文件起始处统一定义一次。 \n
  *
+ * 仅当{@link OH_LOG_IsLevelEnabled}对该级别为true时才对参数求值。 \n
+ *
  * @param type 日志类型，三方应用日志类型为{@link LOG_APP}。
  * @param fmt 格式化字符串，基于类printf格式的增强，支持隐私参数标识，即在格式字符串每个参数中符号后类型前增加{public}、{private}标识。 \n
  * @param ... 与格式字符串里参数类型对应的参数列表，参数数目、参数类型必须与格式字符串中的标识一一对应。
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_DEBUG(type, ...) ((void)OH_LOG_Print((type), LOG_DEBUG, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_DEBUG(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_DEBUG) && \
+    HILOG_PRINT((type), LOG_DEBUG, __VA_ARGS__)))
 
 /**
  * @brief INFO级别写日志，宏封装接口。
  *
  * 使用时需要先定义LOG_DOMAIN和LOG_TAG，一般在源文件起始处统一定义一次。 \n
  *
+ * 仅当{@link OH_LOG_IsLevelEnabled}对该级别为true时才对参数求值。 \n
+ *
  * @param type 日志类型，三方应用日志类型为{@link LOG_APP}。
  * @param fmt 格式化字符串，基于类printf格式的增强，支持隐私参数标识，即在格式字符串每个参数中符号后类型前增加{public}、{private}标识。 \n
  * @param ... 与格式字符串里参数类型对应的参数列表，参数数目、参数类型必须与格式字符串中的标识一一对应。
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_INFO(type, ...) ((void)OH_LOG_Print((type), LOG_INFO, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_INFO(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_INFO) && \
+    HILOG_PRINT((type), LOG_INFO, __VA_ARGS__)))
 
 /**
  * @brief WARN级别写日志，宏封装接口。
  *
  * 使用时需要先定义LOG_DOMAIN和LOG_TAG，一般在源文件起始处统一定义一次。 \n
  *
+ * 仅当{@link OH_LOG_IsLevelEnabled}对该级别为true时才对参数求值。 \n
+ *
  * @param type 日志类型，三方应用日志类型为{@link LOG_APP}。
  * @param fmt 格式化字符串，基于类printf格式的增强，支持隐私参数标识，即在格式字符串每个参数中符号后类型前增加{public}、{private}标识。 \n
  * @param ... 与格式字符串里参数类型对应的参数列表，参数数目、参数类型必须与格式字符串中的标识一一对应。
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_WARN(type, ...) ((void)OH_LOG_Print((type), LOG_WARN, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_WARN(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_WARN) && \
+    HILOG_PRINT((type), LOG_WARN, __VA_ARGS__)))
 
 /**
  * @brief ERROR级别写日志，宏封装接口。
  *
  * 使用时需要先定义LOG_DOMAIN和LOG_TAG，一般在源文件起始处统一定义一次。 \n
  *
+ * 仅当{@link OH_LOG_IsLevelEnabled}对该级别为true时才对参数求值。 \n
+ *
  * @param type 日志类型，三方应用日志类型为{@link LOG_APP}。
  * @param fmt 格式化字符串，基于类printf格式的增强，支持隐私参数标识，即在格式字符串每个参数中符号后类型前增加{public}、{private}标识。 \n
  * @param ... 与格式字符串里参数类型对应的参数列表，参数数目、参数类型必须与格式字符串中的标识一一对应。
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_ERROR(type, ...) ((void)OH_LOG_Print((type), LOG_ERROR, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_ERROR(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_ERROR) && \
+    HILOG_PRINT((type), LOG_ERROR, __VA_ARGS__)))
 
 /**
  * @brief FATAL级别写日志，宏封装接口。
  *
  * 使用时需要先定义LOG_DOMAIN和LOG_TAG，一般在源文件起始处统一定义一次。 \n
  *
+ * 仅当{@link OH_LOG_IsLevelEnabled}对该级别为true时才对参数求值。 \n
+ *
  * @param type 日志类型，三方应用日志类型为{@link LOG_APP}。
  * @param fmt 格式化字符串，基于类printf格式的增强，支持隐私参数标识，即在格式字符串每个参数中符号后类型前增加{public}、{private}标识。 \n
  * @param ... 与格式字符串里参数类型对应的参数列表，参数数目、参数类型必须与格式字符串中的标识一一对应。
  * @see OH_LOG_Print
  * @since 8
  */
-#define OH_LOG_FATAL(type, ...) ((void)OH_LOG_Print((type), LOG_FATAL, LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+#define OH_LOG_FATAL(type, ...) ((void)(HILOG_FORMAT_CHECK(__VA_ARGS__) OH_LOG_IsLevelEnabled(LOG_FATAL) && \
+    HILOG_PRINT((type), LOG_FATAL, __VA_ARGS__)))
 
 /**
  * @brief 函数指针，开发者自定义回调函数内容，在回调函数中，可自行对hilog日志进行处理。
@@ -331,9 +383,256 @@ void OH_LOG_SetMinLogLevel(LogLevel level);
  */
 void OH_LOG_SetLogLevel(LogLevel level, PreferStrategy prefer);
 
+/**
+ * @brief 延迟日志模式的统计信息，通过{@link OH_LOG_GetDeferredStats}获取。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /** 写入各线程环形缓冲区的日志条数。 */
+    unsigned long long recorded;
+    /** 后台输出线程格式化并输出的日志条数。 */
+    unsigned long long flushed;
+    /** 因调用线程环形缓冲区已满而丢弃的日志条数。 */
+    unsigned long long dropped;
+    /** 后台输出线程输出的批次数。 */
+    unsigned long long batches;
+} LogDeferredStats;
+
+/**
+ * @brief 开启当前进程的延迟日志模式。
+ *
+ * 延迟模式下，{@link OH_LOG_Print}和{@link OH_LOG_VPrint}不在调用线程上格式化日志，而是将格式字符串和原始参数写入调用线程
+ * 独占的无锁环形缓冲区，由后台输出线程格式化后批量输出。格式字符串、日志标签和字符串参数都会被拷贝到记录中，调用返回后
+ * 即可释放或修改。如需避免拷贝格式字符串和日志标签，可通过{@link OH_LOG_RegisterFormat}注册一次，再通过
+ * {@link OH_LOG_PrintById}输出日志，记录中只保存其ID；在包含本头文件前定义<b>HILOG_INTERN_FORMAT</b>时，日志宏对每个
+ * 调用点自动采用该方式，此时格式字符串和<b>LOG_TAG</b>必须为字符串字面量。若调用线程的环形缓冲区已满，该条日志被丢弃并
+ * 计入{@link LogDeferredStats}。 \n
+ * <b>LOG_FATAL</b>级别日志、{@link OH_LOG_PrintMsg}和{@link OH_LOG_PrintMsgByLen}始终在输出调用线程已缓冲的日志后同步输出。
+ * 通过{@link OH_LOG_SetCallback}设置的回调仍接收全部日志，同一线程的日志保持顺序，延迟记录的回调在后台输出线程上调用。 \n
+ *
+ * @param bufferSize 每个线程环形缓冲区的大小，单位为字节，向上取整为2的幂。取值为<b>0</b>表示使用默认大小64KB。
+ * @param flushIntervalMs 日志在环形缓冲区中停留的最长时间，单位为毫秒。取值为<b>0</b>表示使用默认间隔100ms。
+ * @return 开启成功或已开启时返回<b>0</b>；否则返回小于<b>0</b>的值。
+ * @see OH_LOG_DisableDeferredMode
+ * @since 26.1.0
+ */
+int OH_LOG_EnableDeferredMode(unsigned int bufferSize, unsigned int flushIntervalMs);
+
+/**
+ * @brief 关闭当前进程的延迟日志模式。
+ *
+ * 函数返回前输出所有已缓冲的日志，之后的日志同步输出。
+ *
+ * @since 26.1.0
+ */
+void OH_LOG_DisableDeferredMode(void);
+
+/**
+ * @brief 输出延迟日志模式下缓冲的所有日志。
+ *
+ * 调用前已缓冲的日志全部输出后返回。未开启延迟模式时不执行任何操作。
+ *
+ * @return 返回输出的日志条数；操作失败时返回小于<b>0</b>的值。
+ * @since 26.1.0
+ */
+int OH_LOG_Flush(void);
+
+/**
+ * @brief 获取延迟日志模式开启以来的统计信息。
+ *
+ * @param stats 指向待填写的统计信息的指针。
+ * @return 成功时返回<b>0</b>；<b>stats</b>为空指针或未开启延迟模式时返回小于<b>0</b>的值。
+ * @since 26.1.0
+ */
+int OH_LOG_GetDeferredStats(LogDeferredStats *stats);
+
+/**
+ * @brief 为{@link OH_LOG_PrintById}注册日志标签和格式字符串。
+ *
+ * 仅保存字符串地址，因此字符串在进程退出前必须保持有效且不被修改，字符串字面量满足该要求。重复注册相同地址返回相同ID，
+ * 因此同一调用点并发首次调用不会产生问题。 \n
+ *
+ * @param tag 日志标签，这是一个用于标识调用所在的类或者业务的字符串。
+ * @param fmt 格式化字符串，基于类printf格式的增强，支持隐私参数标识。
+ * @return 成功时返回大于<b>0</b>的格式ID；<b>tag</b>或<b>fmt</b>为空指针或注册表已满时返回小于<b>0</b>的值。
+ * @see OH_LOG_PrintById
+ * @since 26.1.0
+ */
+int OH_LOG_RegisterFormat(const char *tag, const char *fmt);
+
+/**
+ * @brief 使用通过{@link OH_LOG_RegisterFormat}注册的格式输出日志。
+ *
+ * 行为与使用已注册日志标签和格式字符串调用{@link OH_LOG_Print}相同。延迟日志模式下，记录中只保存ID和参数。 \n
+ *
+ * @param type 日志类型，三方应用日志类型为{@link LOG_APP}。
+ * @param level 日志级别，日志级别包括<b>LOG_DEBUG</b>, <b>LOG_INFO</b>, <b>LOG_WARN</b>, <b>LOG_ERROR</b>, and <b>LOG_FATAL</b>。
+ * @param domain 日志业务领域，16进制整数，范围0x0~0xFFFF。
+ * @param formatId {@link OH_LOG_RegisterFormat}返回的ID。
+ * @param ... 参数列表。参数数目、参数类型必须与已注册格式字符串中的格式说明符对应。
+ * @return 大于等于<b>0</b>表示成功；<b>formatId</b>未注册或操作失败时返回小于<b>0</b>的值。
+ * @since 26.1.0
+ */
+int OH_LOG_PrintById(LogType type, LogLevel level, unsigned int domain, int formatId, ...);
+
 #ifdef __cplusplus
 }
 #endif
+
+#if defined(__cplusplus) && (__cplusplus >= 201402L)
+/**
+ * @brief 获取字符串开头的隐私标识长度。
+ *
+ * @param p 待检查的字符串。
+ * @return 字符串以<b>{public}</b>或<b>{private}</b>开头时返回其长度；否则返回<b>0</b>。
+ * @since 26.1.0
+ */
+constexpr int OH_LOG_PrivacyTagLength(const char *p)
+{
+    const char *tags[] = { "{public}", "{private}" };
+    for (const char *tag : tags) {
+        int len = 0;
+        while (tag[len] != '\0' && p[len] == tag[len]) {
+            ++len;
+        }
+        if (tag[len] == '\0') {
+            return len;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 在编译期检查HiLog格式字符串。
+ *
+ * 格式字符串合法的条件为：每个转换说明的形式为<b>%[{public}|{private}][flags][width][.precision][length]conversion</b>，
+ * 字面百分号使用<b>%%</b>，且不使用<b>%n</b>。隐私标识必须紧跟在%符号之后，且不能出现在格式字符串的其他位置。 \n
+ *
+ * @param fmt 格式字符串。
+ * @return 格式字符串合法时返回<b>true</b>；否则返回<b>false</b>。
+ * @since 26.1.0
+ */
+constexpr bool OH_LOG_CheckFormat(const char *fmt)
+{
+    if (fmt == nullptr) {
+        return true;
+    }
+    for (const char *p = fmt; *p != '\0'; ++p) {
+        if (*p != '%') {
+            if (OH_LOG_PrivacyTagLength(p) != 0) {
+                return false;
+            }
+            continue;
+        }
+        ++p;
+        if (*p == '%') {
+            continue;
+        }
+        if (*p == '{') {
+            int len = OH_LOG_PrivacyTagLength(p);
+            if (len == 0) {
+                return false;
+            }
+            p += len;
+        }
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+            ++p;
+        }
+        while ((*p >= '0' && *p <= '9') || *p == '*') {
+            ++p;
+        }
+        if (*p == '.') {
+            ++p;
+            while ((*p >= '0' && *p <= '9') || *p == '*') {
+                ++p;
+            }
+        }
+        while (*p == 'h' || *p == 'l' || *p == 'L' || *p == 'j' || *p == 'z' || *p == 't' || *p == 'q') {
+            ++p;
+        }
+        bool known = false;
+        for (const char *c = "diouxXeEfFgGaAcsp"; *c != '\0'; ++c) {
+            known = known || (*p == *c);
+        }
+        if (!known) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 在编译期报告非法的HiLog格式字符串。
+ *
+ * 在包含本头文件前定义<b>HILOG_CHECK_FORMAT</b>时，日志宏使用{@link OH_LOG_CheckFormat}对格式字符串的检查结果实例化该模板，
+ * 此时格式字符串必须为字符串字面量。该模板仅在C++14及以上版本可用；在C语言和更早的C++版本中，<b>HILOG_CHECK_FORMAT</b>不产生
+ * 任何效果。 \n
+ *
+ * @since 26.1.0
+ */
+template <bool valid>
+struct OH_LOG_FormatCheck {
+    static_assert(valid, "invalid hilog format string, see OH_LOG_CheckFormat");
+    static constexpr int value = 0;
+};
+
+#ifdef HILOG_CHECK_FORMAT
+/**
+ * @brief 展开为日志宏的第一个参数，即格式字符串。该宏为{@link HILOG_FORMAT_CHECK}的辅助宏。
+ *
+ * @since 26.1.0
+ */
+#define HILOG_FIRST_ARG(fmt, ...) (fmt)
+
+/**
+ * @brief 通过{@link OH_LOG_FormatCheck}在编译期检查日志宏的格式字符串。该宏为日志宏的辅助宏。
+ *
+ * @since 26.1.0
+ */
+#define HILOG_FORMAT_CHECK(...) (void)OH_LOG_FormatCheck<OH_LOG_CheckFormat(HILOG_FIRST_ARG(__VA_ARGS__, 0))>::value,
+#endif
+#endif
+
+#ifndef HILOG_FORMAT_CHECK
+/**
+ * @brief 不在编译期检查日志宏的格式字符串时，该宏展开为空。该宏为日志宏的辅助宏。
+ *
+ * 由于{@link OH_LOG_CheckFormat}依赖C++14的constexpr函数，<b>HILOG_CHECK_FORMAT</b>仅在C++14及以上版本生效；在C语言和更早的
+ * C++版本中，定义该宏不产生任何效果。 \n
+ *
+ * @since 26.1.0
+ */
+#define HILOG_FORMAT_CHECK(...)
+#endif
+
+#if defined(HILOG_INTERN_FORMAT) && defined(__GNUC__)
+/**
+ * @brief 通过每个调用点只注册一次的格式ID输出日志宏的日志。该宏为日志宏的辅助宏。
+ *
+ * 在包含本头文件前定义<b>HILOG_INTERN_FORMAT</b>时使用，此时格式字符串和<b>LOG_TAG</b>必须为字符串字面量。注册失败时，
+ * 通过{@link OH_LOG_Print}输出日志。 \n
+ *
+ * @since 26.1.0
+ */
+#define HILOG_PRINT(type, level, fmt, ...) __extension__({ \
+    static int hilogFormatId = 0; \
+    int hilogId = __atomic_load_n(&hilogFormatId, __ATOMIC_RELAXED); \
+    if (hilogId == 0) { \
+        hilogId = OH_LOG_RegisterFormat("" LOG_TAG "", "" fmt ""); \
+        __atomic_store_n(&hilogFormatId, hilogId, __ATOMIC_RELAXED); \
+    } \
+    hilogId > 0 ? OH_LOG_PrintById((type), (level), LOG_DOMAIN, hilogId, ##__VA_ARGS__) : \
+        OH_LOG_Print((type), (level), LOG_DOMAIN, LOG_TAG, fmt, ##__VA_ARGS__); \
+})
+#else
+/**
+ * @brief 通过{@link OH_LOG_Print}输出日志宏的日志。该宏为日志宏的辅助宏。
+ *
+ * @since 26.1.0
+ */
+#define HILOG_PRINT(type, level, ...) OH_LOG_Print((type), (level), LOG_DOMAIN, LOG_TAG, __VA_ARGS__)
+#endif
 /** @} */
 
 #ifdef HILOG_RAWFORMAT
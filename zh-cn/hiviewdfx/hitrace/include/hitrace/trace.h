@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -49,6 +49,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -732,6 +733,265 @@ int32_t OH_HiTrace_RegisterTraceListener(OH_HiTrace_TraceEventListener callback)
  */
 int32_t OH_HiTrace_UnregisterTraceListener(int32_t index);
 
+/**
+ * @brief trace类别，用于将一组同时开启和采样的跟踪点归为一类。
+ * 类别通过{@link OH_HiTrace_RegisterCategory}获取，在进程退出前一直有效。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiTrace_Category {
+    /**
+     * 是否记录该类别的跟踪点。该值由HiTrace维护，在应用trace捕获开启或停止时变化。请仅通过
+     * {@link OH_HiTrace_IsCategoryEnabled}读取。
+     * @since 26.1.0
+     */
+    uint32_t enabled;
+    /**
+     * 预留字段。
+     * @since 26.1.0
+     */
+    uint32_t reserved;
+} HiTrace_Category;
+
+/**
+ * @brief 由{@link OH_HiTrace_SpanBegin}开始、由{@link OH_HiTrace_SpanEnd}结束的跟踪区间。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiTrace_Span {
+    /**
+     * 区间所属跟踪点的ID。
+     * @since 26.1.0
+     */
+    uint32_t tracePointId;
+    /**
+     * 区间的开始令牌。取值为0表示该区间未被记录。
+     * @since 26.1.0
+     */
+    uint64_t token;
+} HiTrace_Span;
+
+/**
+ * @brief 注册trace类别。
+ * 重复注册相同名称时返回同一个类别。
+ *
+ * @param name 类别名称，接口内部会拷贝该名称。
+ * @param level 该类别下跟踪点的trace输出级别。
+ * @return 指向类别的指针，在进程退出前一直有效；name为NULL或内存分配失败时返回NULL。
+ * @since 26.1.0
+ */
+const HiTrace_Category *OH_HiTrace_RegisterCategory(const char *name, HiTrace_Output_Level level);
+
+/**
+ * @brief 设置trace类别的采样间隔。
+ * 设置采样后，每个线程上该类别每interval个区间只记录一个，嵌套在未记录区间内的区间也不记录。
+ *
+ * @param category 通过{@link OH_HiTrace_RegisterCategory}获取的trace类别。
+ * @param interval 采样间隔。取值为0或1表示记录每个区间。
+ * @return 结果码。
+ *     0：设置成功；
+ *     -1：category无效。
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_SetCategorySampling(const HiTrace_Category *category, uint32_t interval);
+
+/**
+ * @brief 注册trace类别下的跟踪点。
+ * 跟踪点名称只驻留一次，记录该跟踪点的区间时只传递其ID。在同一类别下重复注册相同名称时返回同一个ID。
+ *
+ * @param category 通过{@link OH_HiTrace_RegisterCategory}获取的trace类别。
+ * @param name 跟踪点名称，接口内部会拷贝该名称。
+ * @return 跟踪点ID；参数无效或内存分配失败时返回0。
+ * @since 26.1.0
+ */
+uint32_t OH_HiTrace_RegisterTracePoint(const HiTrace_Category *category, const char *name);
+
+/**
+ * @brief 记录跟踪点区间的开始。
+ * 建议使用{@link OH_HiTrace_SpanBegin}而不是直接调用该接口，以便类别关闭时不产生任何调用。
+ *
+ * @param tracePointId 通过{@link OH_HiTrace_RegisterTracePoint}获取的跟踪点ID。
+ * @return 传递给{@link OH_HiTrace_EndTracePoint}的令牌；因采样未记录、trace捕获已停止或tracePointId无效时返回0。
+ * @since 26.1.0
+ */
+uint64_t OH_HiTrace_BeginTracePoint(uint32_t tracePointId);
+
+/**
+ * @brief 记录跟踪点区间的结束。
+ * 区间必须在开始它的线程上，按与开始相反的顺序结束。
+ *
+ * @param tracePointId 跟踪点ID。
+ * @param token {@link OH_HiTrace_BeginTracePoint}返回的非零令牌。
+ * @since 26.1.0
+ */
+void OH_HiTrace_EndTracePoint(uint32_t tracePointId, uint64_t token);
+
+/**
+ * @brief 获取跟踪点使用的时间戳，单位为纳秒。
+ * 时间戳从单调时钟读取，不产生系统调用，可与捕获的trace中的时间戳比较。
+ *
+ * @return 时间戳，单位为纳秒。
+ * @since 26.1.0
+ */
+uint64_t OH_HiTrace_GetTimestamp(void);
+
+/**
+ * @brief 检查是否记录某类别的跟踪点，宏封装接口。
+ * 该检查仅读取类别的一个字段，不产生函数调用。
+ *
+ * @param category 通过{@link OH_HiTrace_RegisterCategory}获取的trace类别。
+ * @return 类别开启时返回true；否则返回false。
+ * @since 26.1.0
+ */
+#define OH_HiTrace_IsCategoryEnabled(category) (__atomic_load_n(&(category)->enabled, __ATOMIC_RELAXED) != 0)
+
+/**
+ * @brief 开始跟踪点的区间。
+ * 类别关闭时，该函数仅检查{@link OH_HiTrace_IsCategoryEnabled}，并返回未记录的区间。
+ *
+ * @param category 跟踪点所属的trace类别。为NULL时（例如{@link OH_HiTrace_RegisterCategory}调用失败），区间不被记录。
+ * @param tracePointId 通过{@link OH_HiTrace_RegisterTracePoint}获取的跟踪点ID。
+ * @return 传递给{@link OH_HiTrace_SpanEnd}的区间。
+ * @since 26.1.0
+ */
+static inline HiTrace_Span OH_HiTrace_SpanBegin(const HiTrace_Category *category, uint32_t tracePointId)
+{
+    HiTrace_Span span = { tracePointId, 0 };
+    if (__builtin_expect(category != NULL && OH_HiTrace_IsCategoryEnabled(category), 0)) {
+        span.token = OH_HiTrace_BeginTracePoint(tracePointId);
+    }
+    return span;
+}
+
+/**
+ * @brief 结束由{@link OH_HiTrace_SpanBegin}开始的区间。
+ * 区间未被记录时不产生任何调用。
+ *
+ * @param span 指向区间的指针。
+ * @since 26.1.0
+ */
+static inline void OH_HiTrace_SpanEnd(HiTrace_Span *span)
+{
+    if (__builtin_expect(span->token != 0, 0)) {
+        OH_HiTrace_EndTracePoint(span->tracePointId, span->token);
+        span->token = 0;
+    }
+}
+
+#define HITRACE_SPAN_VAR_CONCAT(name, line) name##line
+#define HITRACE_SPAN_VAR(line) HITRACE_SPAN_VAR_CONCAT(hitraceScopedSpan, line)
+
+/**
+ * @brief 记录从该语句到所在作用域结束的跟踪点区间，宏封装接口。
+ * 作用域退出时自动结束该区间。
+ *
+ * @param category 跟踪点所属的trace类别。
+ * @param tracePointId 通过{@link OH_HiTrace_RegisterTracePoint}获取的跟踪点ID。
+ * @since 26.1.0
+ */
+#define OH_HiTrace_ScopedSpan(category, tracePointId) \
+    HiTrace_Span HITRACE_SPAN_VAR(__LINE__) __attribute__((cleanup(OH_HiTrace_SpanEnd))) = \
+        OH_HiTrace_SpanBegin((category), (tracePointId))
+
+/**
+ * @brief 进程内trace会话，不依赖trace捕获服务，将当前进程的trace记录到本地缓冲区。
+ *
+ * @since 26.1.0
+ */
+typedef struct HiTrace_Session HiTrace_Session;
+
+/**
+ * @brief 进程内trace会话的导出格式。
+ *
+ * @since 26.1.0
+ */
+typedef enum HiTrace_ExportFormat {
+    /**
+     * @brief Perfetto protobuf trace格式。
+     *
+     * @since 26.1.0
+     */
+    HITRACE_EXPORT_FORMAT_PERFETTO = 0,
+
+    /**
+     * @brief Chrome JSON trace event格式。
+     *
+     * @since 26.1.0
+     */
+    HITRACE_EXPORT_FORMAT_CHROME_JSON = 1
+} HiTrace_ExportFormat;
+
+/**
+ * @brief 创建进程内trace会话。
+ * 会话运行期间，当前进程中输出级别不低于level的同步trace、异步trace、整数跟踪trace和跟踪点区间，除进入应用trace捕获外，
+ * 还会记录到产生该trace的线程的环形缓冲区中。环形缓冲区写满时覆盖该线程最早的记录。一个进程同一时间只能存在一个会话。
+ *
+ * @param bufferSize 每个线程环形缓冲区的大小，单位为字节。取值为0表示使用默认大小256KB。
+ * @param level 记录的最低trace输出级别。
+ * @return 指向会话的指针；已存在会话或内存分配失败时返回NULL。
+ * @since 26.1.0
+ */
+HiTrace_Session *OH_HiTrace_CreateSession(uint32_t bufferSize, HiTrace_Output_Level level);
+
+/**
+ * @brief 开始记录进程内trace会话。
+ * 会话运行期间，通过{@link OH_HiTrace_RegisterCategory}注册的类别处于开启状态。
+ *
+ * @param session 通过{@link OH_HiTrace_CreateSession}创建的会话。
+ * @return 结果码。
+ *     0：操作成功；
+ *     -1：session无效；
+ *     -2：会话已在运行。
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_StartSession(HiTrace_Session *session);
+
+/**
+ * @brief 停止记录进程内trace会话。
+ * 已记录的数据保留到会话销毁或再次开始。
+ *
+ * @param session 通过{@link OH_HiTrace_CreateSession}创建的会话。
+ * @return 结果码。
+ *     0：操作成功；
+ *     -1：session无效；
+ *     -2：会话未在运行。
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_StopSession(HiTrace_Session *session);
+
+/**
+ * @brief 将已停止的进程内trace会话记录的数据导出到文件。
+ * 异步trace导出为异步区间，整数跟踪trace导出为计数器，同步trace和跟踪点区间导出为产生该trace的线程上的区间。
+ *
+ * @param session 通过{@link OH_HiTrace_CreateSession}创建的会话。
+ * @param format 导出格式。
+ * @param path 写入的文件路径。已存在的文件会被覆盖。
+ * @return 结果码。
+ *     0：操作成功；
+ *     -1：参数无效；
+ *     -2：会话正在运行；
+ *     -3：文件写入失败。
+ * @since 26.1.0
+ */
+int32_t OH_HiTrace_ExportSession(HiTrace_Session *session, HiTrace_ExportFormat format, const char *path);
+
+/**
+ * @brief 获取进程内trace会话自上次开始以来环形缓冲区中被覆盖的记录数。
+ *
+ * @param session 通过{@link OH_HiTrace_CreateSession}创建的会话。
+ * @return 被覆盖的记录数；session无效时返回0。
+ * @since 26.1.0
+ */
+uint64_t OH_HiTrace_GetSessionOverwrittenCount(const HiTrace_Session *session);
+
+/**
+ * @brief 销毁进程内trace会话。会话正在运行时先停止会话。
+ *
+ * @param session 通过{@link OH_HiTrace_CreateSession}创建的会话。
+ * @since 26.1.0
+ */
+void OH_HiTrace_DestroySession(HiTrace_Session *session);
+
 #ifdef __cplusplus
 }
 #endif
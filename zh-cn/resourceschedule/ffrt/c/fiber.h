@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -41,6 +41,7 @@
 #ifndef FFRT_API_C_FIBER_H
 #define FFRT_API_C_FIBER_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "type_def.h"
 
@@ -74,5 +75,112 @@ FFRT_C_API int ffrt_fiber_init(ffrt_fiber_t* fiber, void(*func)(void*), void* ar
  */
 FFRT_C_API void ffrt_fiber_switch(ffrt_fiber_t* from, ffrt_fiber_t* to);
 
+/**
+ * @brief 纤程池句柄，用于标识不同的纤程池。
+ *
+ * 纤程池持有一组相同大小的纤程栈，并在纤程之间复用这些栈，因此创建纤程无需新建内存映射。
+ *
+ * @since 26.1.0
+ */
+typedef void* ffrt_fiber_pool_t;
+
+/**
+ * @brief 创建纤程池。
+ *
+ * 纤程栈从大块共享映射中切分，持有该栈的纤程释放后可被复用。`guard_page`为`true`时，每个栈下方放置一个
+ * 不可访问的保护页，栈溢出时触发异常而不是破坏相邻栈。
+ *
+ * @param stack_size 每个纤程栈的大小，单位是字节。该值向上取整为页大小的整数倍，且必须足以容纳纤程上下文。
+ * @param capacity 可同时从纤程池中获取的纤程数上限。`0`表示不限制。
+ * @param guard_page 是否在每个栈下方放置保护页。
+ * @return 纤程池创建成功时返回非空的纤程池句柄；
+ *         否则返回空指针。
+ * @see ffrt_fiber_pool_destroy
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_fiber_pool_t ffrt_fiber_pool_create(size_t stack_size, uint32_t capacity, bool guard_page);
+
+/**
+ * @brief 销毁纤程池。
+ *
+ * 从纤程池获取的所有纤程必须已释放，且纤程池上不能有正在执行的{@link ffrt_fiber_pool_run}；否则行为未定义。
+ *
+ * @param pool 纤程池句柄。
+ * @return 纤程池销毁成功时返回`ffrt_success`；
+ *         `pool`为空时返回`ffrt_error_inval`；
+ *         仍有从纤程池获取的纤程未释放时返回`ffrt_error_busy`。
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_fiber_pool_destroy(ffrt_fiber_pool_t pool);
+
+/**
+ * @brief 从纤程池获取纤程。
+ *
+ * 返回的纤程已在纤程池持有的栈上按{@link ffrt_fiber_init}的方式完成初始化，可通过{@link ffrt_fiber_switch}运行。
+ * 纤程的入口函数不再运行后，必须通过{@link ffrt_fiber_pool_release}归还该纤程。
+ *
+ * @param pool 纤程池句柄。
+ * @param func 纤程将执行的入口函数。
+ * @param arg 传递给入口函数的参数。
+ * @return 获取成功时返回指向纤程的非空指针；
+ *         `pool`或`func`为空、达到纤程池容量上限或内存分配失败时返回空指针。
+ * @see ffrt_fiber_pool_release
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_fiber_t* ffrt_fiber_pool_acquire(ffrt_fiber_pool_t pool, void(*func)(void*), void* arg);
+
+/**
+ * @brief 将纤程归还给纤程池。
+ *
+ * 纤程栈由纤程池保留以便复用。纤程不能处于运行状态，归还后不可再使用。
+ *
+ * @param pool 纤程池句柄。
+ * @param fiber 通过{@link ffrt_fiber_pool_acquire}从`pool`获取的纤程。
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_fiber_pool_release(ffrt_fiber_pool_t pool, ffrt_fiber_t* fiber);
+
+/**
+ * @brief 在纤程池的调度器上派生纤程。
+ *
+ * 从纤程池获取一个纤程并追加到纤程池的运行队列。该纤程在下一次对该纤程池调用{@link ffrt_fiber_pool_run}时开始运行，
+ * 入口函数返回后自动归还给纤程池。
+ *
+ * @param pool 纤程池句柄。
+ * @param func 纤程将执行的入口函数。
+ * @param arg 传递给入口函数的参数。
+ * @return 派生成功时返回`ffrt_success`；
+ *         `pool`或`func`为空时返回`ffrt_error_inval`；
+ *         达到纤程池容量上限或内存分配失败时返回`ffrt_error_nomem`。
+ * @see ffrt_fiber_pool_run
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_fiber_pool_spawn(ffrt_fiber_pool_t pool, void(*func)(void*), void* arg);
+
+/**
+ * @brief 运行纤程池上派生的纤程。
+ *
+ * 该函数会独占调用线程，按先进先出顺序运行已派生的纤程，直到运行队列为空。运行中的纤程通过调用
+ * {@link ffrt_fiber_pool_yield}或从入口函数返回来让出调用线程。运行期间新派生的纤程在同一次调用中运行。
+ *
+ * @param pool 纤程池句柄。
+ * @return 所有已派生的纤程执行完成时返回`ffrt_success`；
+ *         `pool`为空时返回`ffrt_error_inval`；
+ *         纤程池已在其他线程上运行时返回`ffrt_error_busy`。
+ * @see ffrt_fiber_pool_spawn
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_fiber_pool_run(ffrt_fiber_pool_t pool);
+
+/**
+ * @brief 当前纤程让出执行权给所属纤程池的调度器。
+ *
+ * 调用纤程被追加到运行队列尾部，并恢复运行队列中的下一个纤程。该函数必须在通过{@link ffrt_fiber_pool_spawn}
+ * 派生的纤程中调用，否则立即返回。
+ *
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_fiber_pool_yield(void);
+
 #endif // FFRT_API_C_FIBER_H
 /** @} */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -40,6 +40,8 @@
 #define FFRT_API_C_LOOP_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <sys/socket.h>
 #include "type_def.h"
 #include "queue.h"
 
@@ -144,5 +146,156 @@ FFRT_C_API ffrt_timer_t ffrt_loop_timer_start(
  */
 FFRT_C_API int ffrt_loop_timer_stop(ffrt_loop_t loop, ffrt_timer_t handle);
 
+/**
+ * @brief 在ffrt loop上初始化完成式I/O。
+ *
+ * 必须在向该loop提交任何`ffrt_loop_io_*`请求之前调用。使用{@link ffrt_io_backend_auto}时，
+ * 内核支持则使用io_uring，否则回退到epoll；可通过{@link ffrt_loop_io_get_backend}查询实际使用的后端。
+ *
+ * @param loop loop句柄。
+ * @param entries 同时在途的I/O请求数上限，取值范围为(0, 32768]。
+ * @param backend 期望使用的I/O后端。
+ * @return 初始化成功时返回`ffrt_success`；
+ *         `loop`为空或`entries`超出范围时返回`ffrt_error_inval`；
+ *         I/O上下文分配失败时返回`ffrt_error_nomem`；
+ *         I/O上下文已初始化时返回`ffrt_error_busy`。
+ * @see ffrt_loop_io_get_backend
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_setup(ffrt_loop_t loop, uint32_t entries, ffrt_io_backend_t backend);
+
+/**
+ * @brief 获取ffrt loop上正在使用的I/O后端。
+ *
+ * @param loop loop句柄。
+ * @return {@link ffrt_loop_io_setup}选定的I/O后端；
+ *         `loop`为空或I/O上下文未初始化时返回`ffrt_io_backend_auto`。
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_backend_t ffrt_loop_io_get_backend(ffrt_loop_t loop);
+
+/**
+ * @brief 在ffrt loop上提交异步读请求。
+ *
+ * 请求先进入队列，在下一次调用{@link ffrt_loop_io_submit}或下一轮loop迭代时与其他排队请求一起提交给内核。
+ * 请求完成前`buf`必须保持有效。
+ *
+ * @param loop loop句柄。
+ * @param fd 读取的文件描述符。
+ * @param buf 目标缓冲区。
+ * @param len 读取的字节数。
+ * @param offset 读取的文件偏移，`-1`表示使用当前文件位置。
+ * @param data 传递给`cb`的用户数据。
+ * @param cb 请求完成时执行的用户回调函数。若通过{@link ffrt_loop_io_wait}获取结果，可为空。
+ * @return 请求入队成功时返回非空的I/O请求句柄；
+ *         否则返回空指针。
+ * @see ffrt_loop_io_wait
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_read(
+    ffrt_loop_t loop, int fd, void* buf, size_t len, int64_t offset, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief 在ffrt loop上提交异步写请求。
+ *
+ * 请求完成前`buf`必须保持有效。
+ *
+ * @param loop loop句柄。
+ * @param fd 写入的文件描述符。
+ * @param buf 源缓冲区。
+ * @param len 写入的字节数。
+ * @param offset 写入的文件偏移，`-1`表示使用当前文件位置。
+ * @param data 传递给`cb`的用户数据。
+ * @param cb 请求完成时执行的用户回调函数。若通过{@link ffrt_loop_io_wait}获取结果，可为空。
+ * @return 请求入队成功时返回非空的I/O请求句柄；
+ *         否则返回空指针。
+ * @see ffrt_loop_io_wait
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_write(
+    ffrt_loop_t loop, int fd, const void* buf, size_t len, int64_t offset, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief 在ffrt loop上提交异步fsync请求。
+ *
+ * @param loop loop句柄。
+ * @param fd 需要同步的文件描述符。
+ * @param datasync 是否仅同步文件数据，与`fdatasync`行为一致。
+ * @param data 传递给`cb`的用户数据。
+ * @param cb 请求完成时执行的用户回调函数。若通过{@link ffrt_loop_io_wait}获取结果，可为空。
+ * @return 请求入队成功时返回非空的I/O请求句柄；
+ *         否则返回空指针。
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_fsync(ffrt_loop_t loop, int fd, bool datasync, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief 在ffrt loop上提交异步accept请求。
+ *
+ * 请求完成前`addr`和`addrlen`必须保持有效。完成时传递给`cb`的结果为接收到的文件描述符。
+ *
+ * @param loop loop句柄。
+ * @param fd 监听套接字。
+ * @param addr 接收对端地址的缓冲区，可为空。
+ * @param addrlen 输入时为`addr`的大小，输出时为实际地址长度。`addr`为空时必须为空。
+ * @param data 传递给`cb`的用户数据。
+ * @param cb 请求完成时执行的用户回调函数。若通过{@link ffrt_loop_io_wait}获取结果，可为空。
+ * @return 请求入队成功时返回非空的I/O请求句柄；
+ *         否则返回空指针。
+ * @since 26.1.0
+ */
+FFRT_C_API ffrt_io_handle_t ffrt_loop_io_accept(
+    ffrt_loop_t loop, int fd, struct sockaddr* addr, socklen_t* addrlen, void* data, ffrt_io_cb cb);
+
+/**
+ * @brief 提交ffrt loop上所有排队的I/O请求。
+ *
+ * 若不调用该接口，排队请求将在下一轮loop迭代时提交。使用io_uring后端时，所有排队请求通过一次系统调用提交。
+ *
+ * @param loop loop句柄。
+ * @return 提交的请求数量；
+ *         `loop`为空或I/O上下文未初始化时返回`-1`。
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_submit(ffrt_loop_t loop);
+
+/**
+ * @brief 等待I/O请求完成。
+ *
+ * 在FFRT任务中调用时，当前任务被挂起，worker线程被释放以执行其他任务，直到请求完成。
+ * 在非FFRT线程中调用时，阻塞调用线程。等待前会先提交排队的请求。
+ *
+ * @param handle I/O请求句柄。
+ * @param result 接收操作结果的指针，结果含义见{@link ffrt_io_cb}，可为空。
+ * @return 请求已完成时返回`ffrt_success`；
+ *         `handle`为空时返回`ffrt_error_inval`。
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_wait(ffrt_io_handle_t handle, int64_t* result);
+
+/**
+ * @brief 取消ffrt loop上的I/O请求。
+ *
+ * 若请求尚未完成，则以`-ECANCELED`结果完成。
+ *
+ * @param loop loop句柄。
+ * @param handle I/O请求句柄。
+ * @return 取消请求成功时返回`ffrt_success`；
+ *         `loop`或`handle`为空时返回`ffrt_error_inval`；
+ *         请求正在完成时返回`ffrt_error_busy`。
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_loop_io_cancel(ffrt_loop_t loop, ffrt_io_handle_t handle);
+
+/**
+ * @brief 销毁I/O请求句柄。
+ *
+ * 若请求仍在途，句柄将在请求完成后释放。销毁后不可再使用该句柄。
+ *
+ * @param handle I/O请求句柄。
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_loop_io_handle_destroy(ffrt_io_handle_t handle);
+
 #endif // FFRT_API_C_LOOP_H
 /** @} */
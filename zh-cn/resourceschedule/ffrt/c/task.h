@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -164,6 +164,54 @@ FFRT_C_API void ffrt_task_attr_set_stack_size(ffrt_task_attr_t* attr, uint64_t s
  */
 FFRT_C_API uint64_t ffrt_task_attr_get_stack_size(const ffrt_task_attr_t* attr);
 
+/**
+ * @brief 设置任务属性中的截止时间。
+ *
+ * 同一QoS的就绪任务中，设置了截止时间的任务按截止时间最早优先的顺序调度，并先于未设置截止时间的任务调度。
+ * 截止时间不改变任务的QoS，也不会抢占正在运行的任务。晚于截止时间完成的任务通过
+ * {@link ffrt_register_deadline_miss_callback}注册的回调上报。
+ *
+ * @param attr 任务属性指针。
+ * @param deadline_us 截止时间，单位为微秒，相对于任务提交时刻。若通过{@link ffrt_task_attr_set_delay}
+ *                    设置了延迟，则相对于延迟结束时刻。`0`表示不设置截止时间，为默认值。
+ * @see ffrt_task_attr_get_deadline
+ * @since 26.1.0
+ */
+FFRT_C_API void ffrt_task_attr_set_deadline(ffrt_task_attr_t* attr, uint64_t deadline_us);
+
+/**
+ * @brief 获取任务属性中的截止时间。
+ *
+ * @param attr 任务属性指针。
+ * @return 截止时间，单位为微秒；未设置截止时间时返回`0`。
+ * @since 26.1.0
+ */
+FFRT_C_API uint64_t ffrt_task_attr_get_deadline(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief 注册用于上报任务错过截止时间的回调。
+ *
+ * 每个进程只保留一个回调，注册新回调将替换之前的回调。
+ *
+ * @param cb 截止时间错过回调。传入空指针表示取消注册。
+ * @param data 传递给`cb`的用户数据。
+ * @return 注册或取消注册成功时返回`ffrt_success`；
+ *         否则返回`ffrt_error`。
+ * @since 26.1.0
+ */
+FFRT_C_API int ffrt_register_deadline_miss_callback(ffrt_deadline_miss_cb cb, void* data);
+
+/**
+ * @brief 获取指定QoS等级下任务错过截止时间的次数。
+ *
+ * 计数从进程启动开始累计，统计QoS等于`qos`的所有设置了截止时间的任务，与是否注册回调无关。
+ *
+ * @param qos QoS等级，取值范围见{@link ffrt_qos_t}。
+ * @return 错过截止时间的次数；`qos`无效时返回`0`。
+ * @since 26.1.0
+ */
+FFRT_C_API uint64_t ffrt_get_deadline_miss_count(ffrt_qos_t qos);
+
 /**
  * @brief 更新当前任务的QoS。
  *
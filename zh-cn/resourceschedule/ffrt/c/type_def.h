@@ -419,6 +419,51 @@ typedef void (*ffrt_timer_cb)(void* data);
  */
 typedef int ffrt_timer_t;
 
+/**
+ * @brief ffrt loop完成式I/O接口使用的I/O后端枚举。
+ *
+ * @since 26.1.0
+ */
+typedef enum {
+    /** 内核支持时选择io_uring，否则回退到epoll。 */
+    ffrt_io_backend_auto = 0,
+    /** 基于io_uring的完成式后端，请求批量提交给内核。 */
+    ffrt_io_backend_uring,
+    /** 基于epoll的就绪式回退后端，fd就绪后再执行对应操作。 */
+    ffrt_io_backend_epoll,
+} ffrt_io_backend_t;
+
+/**
+ * @brief I/O完成回调函数类型。
+ *
+ * 提交到ffrt loop的I/O请求完成时，在loop线程上调用该回调。`data`指针携带提交时传入的用户数据。
+ *
+ * @param data 指向I/O提交时传入的用户数据指针。
+ * @param result 操作结果：读写操作为实际传输的字节数，fsync为`0`，accept为接收到的文件描述符，
+ *               操作失败时为负的errno值。
+ * @since 26.1.0
+ */
+typedef void (*ffrt_io_cb)(void* data, int64_t result);
+
+/**
+ * @brief I/O请求句柄，用于标识已提交的I/O请求。
+ *
+ * @since 26.1.0
+ */
+typedef void* ffrt_io_handle_t;
+
+/**
+ * @brief 截止时间错过回调函数类型。
+ *
+ * 通过{@link ffrt_task_attr_set_deadline}设置了截止时间的任务晚于截止时间完成后，在worker线程上调用该回调。
+ *
+ * @param data 指向回调注册时传入的用户数据指针。
+ * @param task_id 错过截止时间的任务ID。
+ * @param lateness_us 任务完成时间相对截止时间的延迟，单位为微秒。
+ * @since 26.1.0
+ */
+typedef void (*ffrt_deadline_miss_cb)(void* data, uint64_t task_id, uint64_t lateness_us);
+
 #ifdef __cplusplus
 namespace ffrt {
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -357,6 +357,138 @@ OH_QoS_GewuErrorCode OH_QoS_GewuAbortRequest(OH_QoS_GewuSession session, OH_QoS_
  */
 OH_QoS_GewuSubmitRequestResult OH_QoS_GewuSubmitRequest(OH_QoS_GewuSession session,
     const char* request, OH_QoS_GewuOnResponse callback, void* context);
+
+/**
+ * @brief 线程组句柄。线程组是协同完成一帧工作的一组线程，例如渲染、音频和输入线程，系统将其作为整体进行提频。
+ *
+ * @since 26.1.0
+ */
+typedef unsigned int OH_QoS_ThreadGroup;
+
+/**
+ * @brief 无效线程组句柄，**OH_QoS_CreateThreadGroup()**失败时写入该值。
+ *
+ * @since 26.1.0
+ */
+#define OH_QOS_INVALID_THREAD_GROUP_ID ((OH_QoS_ThreadGroup)(0xffffffffU))
+
+/**
+ * @brief 线程组的CPU使用情况，通过**OH_QoS_GetThreadGroupStats()**获取。
+ *
+ * @since 26.1.0
+ */
+typedef struct {
+    /**
+     * @brief 统计窗口内线程组所有线程消耗的CPU时间总和，单位为微秒。
+     *
+     * @since 26.1.0
+     */
+    unsigned long long cpuTimeUs;
+    /**
+     * @brief 统计窗口长度，单位为微秒。统计窗口从线程组创建或上一次获取统计信息（取较晚者）开始。
+     *
+     * @since 26.1.0
+     */
+    unsigned long long windowUs;
+    /**
+     * @brief 统计窗口内通过**OH_QoS_ThreadGroupFrameBegin()**标记的帧数。
+     *
+     * @since 26.1.0
+     */
+    unsigned int frames;
+    /**
+     * @brief 统计窗口内帧结束标记晚于帧开始后一个帧周期的帧数。
+     *
+     * @since 26.1.0
+     */
+    unsigned int overrunFrames;
+} OH_QoS_ThreadGroupStats;
+
+/**
+ * @brief 创建线程组。加入线程组的线程共享线程组的QoS等级，系统在每一帧前后对线程组内所有线程统一提频，而不是逐个线程提频。
+ * 例如：可将游戏的渲染、音频和输入线程放入同一个帧周期为16666微秒（60Hz）的线程组，使其在每次vsync前获得一致的调度。
+ *
+ * @param level 线程组内线程的QoS等级。详见{@link QoS_Level}。
+ * @param framePeriodUs 线程组的帧周期，单位为微秒。取值为0表示线程组不绑定帧，仅应用QoS等级。
+ * @param group 输出参数，创建的线程组句柄会写入该变量；失败时写入{@link OH_QOS_INVALID_THREAD_GROUP_ID}。此参数不允许为NULL。
+ * @return 成功返回0，如果参数无效、进程线程组数量达到上限或内部错误失败则返回-1。
+ * @see OH_QoS_DestroyThreadGroup
+ * @since 26.1.0
+ */
+int OH_QoS_CreateThreadGroup(QoS_Level level, unsigned int framePeriodUs, OH_QoS_ThreadGroup *group);
+
+/**
+ * @brief 销毁线程组。线程组内的线程被移出线程组，并重置其QoS等级，效果等同于对每个线程调用**OH_QoS_ResetThreadQoS()**。
+ * 调用该接口后，线程组句柄不可再使用。
+ *
+ * @param group 线程组句柄。
+ * @return 成功返回0，如果线程组不存在或内部错误失败则返回-1。
+ * @since 26.1.0
+ */
+int OH_QoS_DestroyThreadGroup(OH_QoS_ThreadGroup group);
+
+/**
+ * @brief 将当前进程的线程加入线程组。一个线程最多属于一个线程组，加入其他线程组时将从原线程组移出。
+ * 线程在线程组内期间，其QoS等级由线程组管理，对该线程调用**OH_QoS_SetThreadQoS()**将失败。
+ *
+ * @param group 线程组句柄。
+ * @param tid 待加入的线程ID。取值为0表示当前线程。
+ * @return 成功返回0，如果线程组不存在、线程不属于当前进程或内部错误失败则返回-1。
+ * @see OH_QoS_RemoveThreadFromGroup
+ * @since 26.1.0
+ */
+int OH_QoS_AddThreadToGroup(OH_QoS_ThreadGroup group, int tid);
+
+/**
+ * @brief 将线程移出线程组，并重置其QoS等级。
+ *
+ * @param group 线程组句柄。
+ * @param tid 待移出的线程ID。取值为0表示当前线程。
+ * @return 成功返回0，如果线程组不存在、线程不在线程组内或内部错误失败则返回-1。
+ * @since 26.1.0
+ */
+int OH_QoS_RemoveThreadFromGroup(OH_QoS_ThreadGroup group, int tid);
+
+/**
+ * @brief 修改线程组的帧周期，例如在屏幕刷新率变化时调用。
+ *
+ * @param group 线程组句柄。
+ * @param framePeriodUs 线程组的帧周期，单位为微秒。取值为0表示线程组不绑定帧。
+ * @return 成功返回0，如果线程组不存在或内部错误失败则返回-1。
+ * @since 26.1.0
+ */
+int OH_QoS_SetThreadGroupFramePeriod(OH_QoS_ThreadGroup group, unsigned int framePeriodUs);
+
+/**
+ * @brief 标记线程组一帧的开始，通常在vsync时调用。从此刻起，系统对线程组内所有线程提频，
+ * 直到调用**OH_QoS_ThreadGroupFrameEnd()**或经过一个帧周期（取较早者）。
+ *
+ * @param group 线程组句柄。
+ * @return 成功返回0，如果线程组不存在或未绑定帧则返回-1。
+ * @see OH_QoS_ThreadGroupFrameEnd
+ * @since 26.1.0
+ */
+int OH_QoS_ThreadGroupFrameBegin(OH_QoS_ThreadGroup group);
+
+/**
+ * @brief 标记线程组一帧的结束。释放**OH_QoS_ThreadGroupFrameBegin()**施加的提频；若帧结束晚于帧开始后一个帧周期，该帧计为超时帧。
+ *
+ * @param group 线程组句柄。
+ * @return 成功返回0，如果线程组不存在或当前没有已开始的帧则返回-1。
+ * @see OH_QoS_ThreadGroupFrameBegin
+ * @since 26.1.0
+ */
+int OH_QoS_ThreadGroupFrameEnd(OH_QoS_ThreadGroup group);
+
+/**
+ * @brief 获取线程组自创建或自上一次调用该接口以来的CPU使用情况，并开始新的统计窗口。
+ *
+ * @param group 线程组句柄。
+ * @param stats 输出参数，统计信息会以{@link OH_QoS_ThreadGroupStats}形式写入该变量。此参数不允许为NULL。
+ * @return 成功返回0，如果线程组不存在、stats为NULL或内部错误失败则返回-1。
+ * @since 26.1.0
+ */
+int OH_QoS_GetThreadGroupStats(OH_QoS_ThreadGroup group, OH_QoS_ThreadGroupStats *stats);
 #ifdef __cplusplus
 };
 #endif